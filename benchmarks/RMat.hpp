@@ -0,0 +1,74 @@
+// Shared pieces of the graph-kernel benchmarks: timing, the [scale]
+// [edgeFactor] command line and a Graph500 R-MAT edge generator.
+
+#pragma once
+#include <chrono>
+#include <cstddef>
+#include <cstdlib>
+#include <random>
+#include <utility>
+#include <vector>
+
+namespace Bench {
+
+using Clock = std::chrono::steady_clock;
+
+inline double seconds(Clock::time_point start) {
+  return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+// R-MAT graph size: 2^scale vertices, edgeFactor sampled edges per vertex.
+struct Config {
+  int scale = 16;
+  int edgeFactor = 16;
+};
+
+// Overrides cfg with argv[1] (scale) and argv[2] (edgeFactor) when given.
+inline Config readConfig(int argc, char **argv, Config cfg) {
+  if (argc > 1)
+    cfg.scale = std::atoi(argv[1]);
+  if (argc > 2)
+    cfg.edgeFactor = std::atoi(argv[2]);
+  return cfg;
+}
+
+// Graph500 R-MAT generator (a = 0.57, b = c = 0.19) with a fixed seed.
+// Calls emit(u, v, rng) for every sampled edge except self loops; emit may
+// draw from rng, e.g. for a weight.
+template <typename Emit> void forEachRMatEdge(const Config &cfg, Emit &&emit) {
+  std::mt19937_64 rng(42);
+  std::uniform_real_distribution<double> coin(0.0, 1.0);
+  const size_t count = (size_t{1} << cfg.scale) * cfg.edgeFactor;
+  for (size_t i = 0; i < count; ++i) {
+    int u = 0, v = 0;
+    for (int bit = 0; bit < cfg.scale; ++bit) {
+      double r = coin(rng);
+      if (r >= 0.95) {
+        u |= 1 << bit;
+        v |= 1 << bit;
+      } else if (r >= 0.76) {
+        u |= 1 << bit;
+      } else if (r >= 0.57) {
+        v |= 1 << bit;
+      }
+    }
+    if (u != v)
+      emit(u, v, rng);
+  }
+}
+
+// Directed R-MAT edges; symmetrized adds v -> u after every u -> v.
+inline std::vector<std::pair<int, int>> rmatEdges(const Config &cfg,
+                                                  bool symmetrized) {
+  std::vector<std::pair<int, int>> edges;
+  edges.reserve((symmetrized ? 2 : 1) * (size_t{1} << cfg.scale) *
+                cfg.edgeFactor);
+  forEachRMatEdge(cfg, [&](int u, int v, std::mt19937_64 &) {
+    edges.emplace_back(u, v);
+    if (symmetrized)
+      edges.emplace_back(v, u);
+  });
+  return edges;
+}
+
+} // namespace Bench
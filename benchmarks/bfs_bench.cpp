@@ -0,0 +1,95 @@
+// BFS on R-MAT graphs: direction-optimizing and parallel BFS versus a plain
+// queue BFS over the same CSR arrays, plus CinderGraph::bfs end to end (the
+// first call includes loading the hybrid CSR from the adjacency list).
+//
+// Usage: bfs_bench [scale] [edgeFactor] [sources]
+
+#include "CinderPeak.hpp"
+#include "RMat.hpp"
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <thread>
+#include <vector>
+
+using namespace CinderPeak;
+using namespace Bench;
+
+int main(int argc, char **argv) {
+  const Config cfg = readConfig(argc, argv, {16, 16});
+  const int sourceCount = argc > 3 ? std::atoi(argv[3]) : 8;
+
+  auto edges = rmatEdges(cfg, true);
+  auto set = buildEdgeSet<int, Unweighted>(edges, EdgeInsertRules{false, true});
+  PeakStore::HybridCSR_COO<int, Unweighted> csr;
+  csr.loadEdgeSet(set);
+
+  // Sources with at least one edge, as Graph500 picks them.
+  std::vector<size_t> sources;
+  std::vector<int> sourceValues;
+  csr.withCSR(false, [&](const Algorithms::CSRView &g, const auto &map) {
+    std::mt19937 rng(7);
+    std::uniform_int_distribution<size_t> pick(0, g.vertices - 1);
+    while (static_cast<int>(sources.size()) < sourceCount) {
+      size_t v = pick(rng);
+      if (g.degree(v) > 0) {
+        sources.push_back(v);
+        sourceValues.push_back(map.value(v));
+      }
+    }
+  });
+
+  double queueSec = 0, directionSec = 0, parallelSec = 0;
+  size_t reached = 0;
+  csr.withCSR(false, [&](const Algorithms::CSRView &g, const auto &) {
+    for (size_t s : sources) {
+      auto start = Clock::now();
+      auto plain = Algorithms::queueBFS(g, s);
+      queueSec += seconds(start);
+
+      start = Clock::now();
+      auto optimized = Algorithms::directionOptimizingBFS(g, s);
+      directionSec += seconds(start);
+      reached += optimized.order.size();
+      if (plain.depth != optimized.depth)
+        std::cerr << "depth mismatch from source " << s << "\n";
+
+      start = Clock::now();
+      auto parallel = Algorithms::parallelBFS(g, s);
+      parallelSec += seconds(start);
+      if (plain.order != parallel.order || plain.parent != parallel.parent)
+        std::cerr << "parallel BFS differs from source " << s << "\n";
+    }
+  });
+
+  auto graph = CinderGraph<int, Unweighted>::fromEdges(
+      edges, GraphCreationOptions({GraphCreationOptions::Undirected}));
+  auto start = Clock::now();
+  graph.bfs(sourceValues[0]);
+  double firstSec = seconds(start);
+  start = Clock::now();
+  for (int s : sourceValues)
+    graph.bfs(s);
+  double apiSec = seconds(start);
+
+  const double n = static_cast<double>(sourceCount);
+  const double traversed = static_cast<double>(set.edges.size());
+  std::cout << std::fixed << std::setprecision(3);
+  std::cout << "R-MAT scale " << cfg.scale << ", edge factor "
+            << cfg.edgeFactor << ": " << set.vertices.size() << " vertices, "
+            << set.edges.size() << " directed edges, " << sourceCount
+            << " sources, avg reached " << reached / sourceCount << "\n";
+  std::cout << "queue BFS              : " << 1e3 * queueSec / n << " ms ("
+            << traversed * n / queueSec / 1e6 << " MTEPS)\n";
+  std::cout << "direction-optimizing   : " << 1e3 * directionSec / n
+            << " ms (" << traversed * n / directionSec / 1e6 << " MTEPS)\n";
+  std::cout << "speedup                : " << queueSec / directionSec << "x\n";
+  std::cout << "parallel BFS           : " << 1e3 * parallelSec / n << " ms ("
+            << traversed * n / parallelSec / 1e6 << " MTEPS, "
+            << std::thread::hardware_concurrency() << " threads)\n";
+  std::cout << "CinderGraph::bfs first : " << 1e3 * firstSec
+            << " ms (includes CSR load)\n";
+  std::cout << "CinderGraph::bfs warm  : " << 1e3 * apiSec / n << " ms\n";
+  return 0;
+}
@@ -0,0 +1,80 @@
+// Connected components on an R-MAT graph: Afforest (neighbor sampling,
+// lock-free link/compress) versus a serial union-find over every edge, on
+// the undirected graph and on the directed one (weak components).
+//
+// Usage: components_bench [scale] [edgeFactor]
+
+#include "CinderPeak.hpp"
+#include "RMat.hpp"
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <numeric>
+#include <thread>
+#include <utility>
+#include <vector>
+
+using namespace CinderPeak;
+using namespace Bench;
+
+namespace {
+
+// Union by index with path halving over every out-edge.
+size_t unionFindCount(const Algorithms::CSRView &g) {
+  std::vector<size_t> parent(g.vertices);
+  std::iota(parent.begin(), parent.end(), 0);
+  auto find = [&](size_t v) {
+    while (parent[v] != v)
+      v = parent[v] = parent[parent[v]];
+    return v;
+  };
+  for (size_t u = 0; u < g.vertices; ++u)
+    for (size_t e = g.offsets[u]; e < g.offsets[u + 1]; ++e) {
+      size_t a = find(u), b = find(g.targets[e]);
+      if (a != b)
+        parent[std::max(a, b)] = std::min(a, b);
+    }
+  size_t count = 0;
+  for (size_t v = 0; v < g.vertices; ++v)
+    count += find(v) == v;
+  return count;
+}
+
+void run(const char *name, const std::vector<std::pair<int, int>> &edges,
+         bool directed) {
+  auto set =
+      buildEdgeSet<int, Unweighted>(edges, EdgeInsertRules{false, true});
+  PeakStore::HybridCSR_COO<int, Unweighted> csr;
+  csr.loadEdgeSet(set);
+  csr.withCSR(directed, [&](const Algorithms::CSRView &g, const auto &) {
+    auto start = Clock::now();
+    size_t expected = unionFindCount(g);
+    double serialSec = seconds(start);
+    start = Clock::now();
+    auto labels = Algorithms::connectedComponents(g);
+    double afforestSec = seconds(start);
+    std::cout << name << ": " << g.vertices << " vertices, " << g.edges()
+              << " edges, " << labels.sizes.size() << " components\n"
+              << "  serial union-find : " << 1e3 * serialSec << " ms\n"
+              << "  Afforest          : " << 1e3 * afforestSec << " ms ("
+              << serialSec / afforestSec << "x)\n";
+    if (labels.sizes.size() != expected)
+      std::cerr << "  union-find found " << expected << " components\n";
+    return 0;
+  });
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+  const Config cfg = readConfig(argc, argv, {18, 16});
+  std::cout << std::fixed << std::setprecision(3) << "R-MAT scale "
+            << cfg.scale << ", edge factor " << cfg.edgeFactor << ", "
+            << std::thread::hardware_concurrency() << " threads\n";
+  // Undirected graphs store both directions of every edge.
+  run("undirected", rmatEdges(cfg, true), false);
+  // The serial baseline only follows out-edges, which already joins the
+  // weak components; Afforest also scans in-edges for the stragglers.
+  run("directed (weak)", rmatEdges(cfg, false), true);
+  return 0;
+}
@@ -0,0 +1,88 @@
+// Edge-list import throughput: CinderGraph::fromFile (mmap + parallel
+// parse + bulk load) versus reading lines with std::getline and calling
+// addEdge per edge.
+//
+// Usage: edgeListImport_bench [edges] [vertices]
+
+#include "CinderPeak.hpp"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <string>
+
+using namespace CinderPeak;
+using Clock = std::chrono::steady_clock;
+
+namespace {
+
+struct Config {
+  int edges = 2000000;
+  int vertices = 100000;
+};
+
+double seconds(Clock::time_point start) {
+  return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+  Config cfg;
+  if (argc > 1)
+    cfg.edges = std::atoi(argv[1]);
+  if (argc > 2)
+    cfg.vertices = std::atoi(argv[2]);
+
+  const std::string path =
+      (std::filesystem::temp_directory_path() / "cinderpeak_import_bench.el")
+          .string();
+  {
+    std::mt19937 rng(1);
+    std::uniform_int_distribution<int> vertex(0, cfg.vertices - 1);
+    std::ofstream out(path);
+    for (int i = 0; i < cfg.edges; ++i)
+      out << vertex(rng) << ' ' << vertex(rng) << ' ' << (i % 100) << '\n';
+  }
+  const double mb =
+      static_cast<double>(std::filesystem::file_size(path)) / (1 << 20);
+
+  auto start = Clock::now();
+  auto imported = CinderGraph<int, int>::fromFile(path);
+  double importSec = seconds(start);
+
+  start = Clock::now();
+  CinderGraph<int, int> manual;
+  {
+    std::ifstream in(path);
+    std::string line;
+    while (std::getline(in, line)) {
+      std::istringstream fields(line);
+      int src = 0, dest = 0, weight = 0;
+      fields >> src >> dest >> weight;
+      if (!manual.hasVertex(src))
+        manual.addVertex(src);
+      if (!manual.hasVertex(dest))
+        manual.addVertex(dest);
+      if (src != dest)
+        manual.addEdge(src, dest, weight);
+    }
+  }
+  double manualSec = seconds(start);
+  std::filesystem::remove(path);
+
+  std::cout << std::fixed << std::setprecision(2);
+  std::cout << "edges: " << cfg.edges << ", vertices: " << cfg.vertices
+            << ", file: " << mb << " MiB\n";
+  std::cout << "fromFile        : " << importSec << " s (" << mb / importSec
+            << " MiB/s, " << imported.numEdges() << " edges)\n";
+  std::cout << "getline+addEdge : " << manualSec << " s (" << mb / manualSec
+            << " MiB/s, " << manual.numEdges() << " edges)\n";
+  std::cout << "speedup         : " << manualSec / importSec << "x\n";
+  return 0;
+}
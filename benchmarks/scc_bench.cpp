@@ -0,0 +1,54 @@
+// Strongly connected components on a directed R-MAT graph: iterative
+// Tarjan versus the parallel trim / forward-backward / coloring kernel.
+//
+// Usage: scc_bench [scale] [edgeFactor]
+
+#include "CinderPeak.hpp"
+#include "RMat.hpp"
+#include <algorithm>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+using namespace CinderPeak;
+using namespace Bench;
+
+int main(int argc, char **argv) {
+  const Config cfg = readConfig(argc, argv, {18, 16});
+
+  auto set = buildEdgeSet<int, Unweighted>(rmatEdges(cfg, false),
+                                           EdgeInsertRules{false, true});
+  PeakStore::HybridCSR_COO<int, Unweighted> csr;
+  csr.loadEdgeSet(set);
+
+  std::cout << std::fixed << std::setprecision(3);
+  csr.withCSR(true, [&](const Algorithms::CSRView &g, const auto &) {
+    std::cout << "R-MAT scale " << cfg.scale << ", edge factor "
+              << cfg.edgeFactor << ": " << g.vertices << " vertices, "
+              << g.edges() << " edges, "
+              << std::thread::hardware_concurrency() << " threads\n";
+
+    auto start = Clock::now();
+    auto expected = Algorithms::stronglyConnectedComponents(g);
+    double tarjanSec = seconds(start);
+    start = Clock::now();
+    auto scc = Algorithms::parallelStronglyConnectedComponents(g);
+    double parallelSec = seconds(start);
+
+    size_t largest = 0;
+    for (size_t size : expected.sizes)
+      largest = std::max(largest, size);
+    std::cout << expected.sizes.size() << " SCCs (largest " << largest
+              << "), condensation has " << expected.dagTargets.size()
+              << " edges\n";
+    std::cout << "iterative Tarjan : " << 1e3 * tarjanSec << " ms\n";
+    std::cout << "trim/FW-BW/color : " << 1e3 * parallelSec << " ms ("
+              << tarjanSec / parallelSec << "x)\n";
+    if (scc.component != expected.component)
+      std::cerr << "parallel labels disagree with Tarjan\n";
+    return 0;
+  });
+  return 0;
+}
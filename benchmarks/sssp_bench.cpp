@@ -0,0 +1,122 @@
+// Single-source shortest paths on a weighted R-MAT graph: Dijkstra with the
+// 4-ary indexed heap versus a std::priority_queue baseline with lazy
+// deletion, and parallel delta-stepping for a few bucket widths.
+//
+// Usage: sssp_bench [scale] [edgeFactor] [sources]
+
+#include "CinderPeak.hpp"
+#include "RMat.hpp"
+#include <cstdlib>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <queue>
+#include <random>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+using namespace CinderPeak;
+using namespace Bench;
+
+namespace {
+
+// R-MAT edges with uniform weights in [1, 255], symmetrized.
+std::vector<std::tuple<int, int, int>> weightedRMatEdges(const Config &cfg) {
+  std::uniform_int_distribution<int> weight(1, 255);
+  std::vector<std::tuple<int, int, int>> edges;
+  edges.reserve(2 * (size_t{1} << cfg.scale) * cfg.edgeFactor);
+  forEachRMatEdge(cfg, [&](int u, int v, std::mt19937_64 &rng) {
+    int w = weight(rng);
+    edges.emplace_back(u, v, w);
+    edges.emplace_back(v, u, w);
+  });
+  return edges;
+}
+
+// Textbook Dijkstra: binary heap, stale entries skipped on pop.
+std::vector<int> lazyDijkstra(const Algorithms::CSRView &g, const int *w,
+                              size_t source) {
+  std::vector<int> dist(g.vertices, Algorithms::unreachedDistance<int>());
+  using Entry = std::pair<int, size_t>;
+  std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry>> heap;
+  dist[source] = 0;
+  heap.emplace(0, source);
+  while (!heap.empty()) {
+    auto [d, u] = heap.top();
+    heap.pop();
+    if (d > dist[u])
+      continue;
+    for (size_t e = g.offsets[u]; e < g.offsets[u + 1]; ++e) {
+      if (d + w[e] < dist[g.targets[e]]) {
+        dist[g.targets[e]] = d + w[e];
+        heap.emplace(d + w[e], g.targets[e]);
+      }
+    }
+  }
+  return dist;
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+  const Config cfg = readConfig(argc, argv, {16, 16});
+  const int sourceCount = argc > 3 ? std::atoi(argv[3]) : 4;
+
+  auto set = buildEdgeSet<int, int>(weightedRMatEdges(cfg),
+                                    EdgeInsertRules{true, true});
+  PeakStore::HybridCSR_COO<int, int> csr;
+  csr.loadEdgeSet(set);
+
+  std::cout << std::fixed << std::setprecision(3);
+  csr.withWeightedCSR(false, [&](const Algorithms::CSRView &g, const int *w,
+                                 const auto &) {
+    std::cout << "R-MAT scale " << cfg.scale << ", edge factor "
+              << cfg.edgeFactor << ": " << g.vertices << " vertices, "
+              << g.edges() << " directed edges, " << sourceCount
+              << " sources, " << std::thread::hardware_concurrency()
+              << " threads\n";
+
+    std::vector<size_t> sources;
+    std::mt19937 rng(7);
+    std::uniform_int_distribution<size_t> pick(0, g.vertices - 1);
+    while (static_cast<int>(sources.size()) < sourceCount) {
+      size_t v = pick(rng);
+      if (g.degree(v) > 0)
+        sources.push_back(v);
+    }
+
+    auto report = [&](const std::string &name, auto &&run) {
+      auto start = Clock::now();
+      for (size_t s : sources)
+        run(s);
+      std::cout << std::left << std::setw(28) << name << ": "
+                << 1e3 * seconds(start) / sourceCount << " ms\n";
+    };
+    std::vector<std::vector<int>> expected;
+    report("priority_queue Dijkstra", [&](size_t s) {
+      expected.push_back(lazyDijkstra(g, w, s));
+    });
+    size_t mismatches = 0;
+    size_t run = 0;
+    report("4-ary heap Dijkstra", [&](size_t s) {
+      mismatches += Algorithms::dijkstra(g, w, s).distance != expected[run++];
+    });
+    for (double delta : {0.0, 16.0, 64.0}) {
+      run = 0;
+      std::string name = "delta-stepping, delta ";
+      name += delta > 0 ? std::to_string(static_cast<int>(delta)) : "auto";
+      report(name, [&](size_t s) {
+        auto tree = Algorithms::deltaStepping(
+            g, w, s, Algorithms::DeltaSteppingOptions{delta, 0});
+        mismatches += tree.distance != expected[run++];
+      });
+    }
+    if (mismatches)
+      std::cerr << mismatches << " runs disagree with the baseline\n";
+    return 0;
+  });
+  return 0;
+}
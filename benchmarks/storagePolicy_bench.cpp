@@ -0,0 +1,68 @@
+// hasVertex/getEdge lookup cost through the virtual storage interface
+// (DynamicStorage) versus the statically bound AdjacencyList
+// (AdjacencyStorage).
+//
+// Usage: storagePolicy_bench [lookups] [vertices]
+
+#include "CinderPeak.hpp"
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+
+using namespace CinderPeak;
+using Clock = std::chrono::steady_clock;
+
+namespace {
+
+struct Config {
+  int lookups = 5000000;
+  int vertices = 1024;
+};
+
+struct Timing {
+  double nsPerPair;
+  size_t hits; // reported so the lookups cannot be optimized away
+};
+
+template <typename Policy> Timing timeLookups(const Config &cfg) {
+  CinderGraph<int, int, Policy> graph;
+  for (int v = 0; v < cfg.vertices; ++v)
+    graph.addVertex(v);
+  for (int v = 1; v < cfg.vertices; ++v)
+    graph.addEdge(v - 1, v, v);
+
+  size_t hits = 0;
+  auto start = Clock::now();
+  for (int i = 0; i < cfg.lookups; ++i) {
+    int v = i % cfg.vertices;
+    hits += graph.hasVertex(v);
+    hits += graph.getEdge(v, v + 1).has_value();
+  }
+  std::chrono::duration<double, std::nano> elapsed = Clock::now() - start;
+  return {elapsed.count() / cfg.lookups, hits};
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+  Config cfg;
+  if (argc > 1)
+    cfg.lookups = std::atoi(argv[1]);
+  if (argc > 2)
+    cfg.vertices = std::atoi(argv[2]);
+
+  Timing dynamic = timeLookups<DynamicStorage>(cfg);
+  Timing fixed = timeLookups<AdjacencyStorage>(cfg);
+
+  std::cout << std::fixed << std::setprecision(2);
+  std::cout << "lookups: " << cfg.lookups << ", vertices: " << cfg.vertices
+            << "\n";
+  std::cout << "DynamicStorage   : " << dynamic.nsPerPair
+            << " ns per lookup pair (" << dynamic.hits << " hits)\n";
+  std::cout << "AdjacencyStorage : " << fixed.nsPerPair
+            << " ns per lookup pair (" << fixed.hits << " hits)\n";
+  std::cout << "speedup          : " << dynamic.nsPerPair / fixed.nsPerPair
+            << "x\n";
+  return 0;
+}
@@ -0,0 +1,343 @@
+#pragma once
+#include "Algorithms/CSRView.hpp"
+#include "StorageEngine/ParallelUtils.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+namespace CinderPeak {
+namespace Algorithms {
+
+// Depth and parent of a vertex the traversal did not reach.
+inline constexpr size_t UNREACHED = SIZE_MAX;
+
+/**
+ * @brief BFS tree over the dense indices of a CSRView.
+ *
+ * order lists reached vertices level by level (the source first). depth and
+ * parent are indexed by vertex and hold UNREACHED for vertices the
+ * traversal did not reach; the source is its own parent.
+ */
+struct BFSTree {
+  std::vector<size_t> order;
+  std::vector<size_t> depth;
+  std::vector<size_t> parent;
+};
+
+// Switching thresholds from Beamer et al., "Direction-Optimizing
+// Breadth-First Search" (SC'12).
+struct BFSOptions {
+  // Go bottom-up once the frontier's out-edges exceed 1/alpha of the edges
+  // left to explore.
+  size_t alpha = 15;
+  // Go back top-down once the frontier shrinks below vertices/beta.
+  size_t beta = 18;
+};
+
+struct ParallelBFSOptions {
+  // Worker threads; 0 uses one per hardware thread.
+  size_t workers = 0;
+  // Levels with fewer frontier edges than this per worker run serially.
+  size_t minEdgesPerWorker = PeakStore::MIN_ITEMS_PER_WORKER;
+};
+
+// Chunks per worker in a parallel level. Workers claim chunks from a shared
+// counter, so one that drew cheap chunks takes over the rest.
+inline constexpr size_t PARALLEL_BFS_CHUNKS_PER_WORKER = 8;
+
+namespace detail {
+
+inline bool testBit(const std::vector<std::atomic<uint64_t>> &bits,
+                    size_t i) {
+  return (bits[i >> 6].load(std::memory_order_relaxed) >> (i & 63)) & 1;
+}
+
+inline void setBit(std::vector<std::atomic<uint64_t>> &bits, size_t i) {
+  bits[i >> 6].fetch_or(uint64_t{1} << (i & 63), std::memory_order_relaxed);
+}
+
+inline void atomicMin(std::atomic<size_t> &slot, size_t value) {
+  size_t current = slot.load(std::memory_order_relaxed);
+  while (value < current &&
+         !slot.compare_exchange_weak(current, value,
+                                     std::memory_order_relaxed)) {
+  }
+}
+
+inline bool testBit(const std::vector<uint64_t> &bits, size_t i) {
+  return (bits[i >> 6] >> (i & 63)) & 1;
+}
+
+inline void setBit(std::vector<uint64_t> &bits, size_t i) {
+  bits[i >> 6] |= uint64_t{1} << (i & 63);
+}
+
+// Index of the lowest set bit; bits must be non-zero.
+inline size_t lowestBit(uint64_t bits) {
+#if defined(_MSC_VER)
+  unsigned long index;
+  _BitScanForward64(&index, bits);
+  return index;
+#else
+  return static_cast<size_t>(__builtin_ctzll(bits));
+#endif
+}
+
+inline BFSTree startTree(const CSRView &g, size_t source) {
+  BFSTree tree;
+  tree.depth.assign(g.vertices, UNREACHED);
+  tree.parent.assign(g.vertices, UNREACHED);
+  tree.order.reserve(g.vertices);
+  tree.depth[source] = 0;
+  tree.parent[source] = source;
+  tree.order.push_back(source);
+  return tree;
+}
+
+} // namespace detail
+
+/**
+ * @brief Plain queue-based BFS, kept as the reference implementation.
+ *
+ * @complexity O(V + E)
+ */
+inline BFSTree queueBFS(const CSRView &g, size_t source) {
+  BFSTree tree = detail::startTree(g, source);
+  for (size_t head = 0; head < tree.order.size(); ++head) {
+    size_t u = tree.order[head];
+    for (size_t e = g.offsets[u]; e < g.offsets[u + 1]; ++e) {
+      size_t v = g.targets[e];
+      if (tree.depth[v] == UNREACHED) {
+        tree.depth[v] = tree.depth[u] + 1;
+        tree.parent[v] = u;
+        tree.order.push_back(v);
+      }
+    }
+  }
+  return tree;
+}
+
+/**
+ * @brief Direction-optimizing BFS.
+ *
+ * Levels are expanded top-down (each frontier vertex scans its out-edges)
+ * while the frontier is small. When its out-edges grow past 1/alpha of the
+ * edges still unexplored, levels switch to bottom-up: every unreached
+ * vertex scans its in-edges for a parent in the frontier bitmap and stops
+ * at the first hit, which skips most edges of large low-diameter graphs.
+ * Once the frontier stops growing and drops below vertices/beta it
+ * switches back.
+ *
+ * Needs g.hasInEdges() to go bottom-up; without in-edges it runs top-down
+ * throughout. Depths match queueBFS exactly; parents and the order within
+ * a level may differ, but every parent is a valid BFS-tree parent.
+ *
+ * @complexity O(V + E) worst case; far fewer edge checks on small-world
+ * graphs.
+ */
+inline BFSTree directionOptimizingBFS(const CSRView &g, size_t source,
+                                      const BFSOptions &options = {}) {
+  BFSTree tree = detail::startTree(g, source);
+  const size_t n = g.vertices;
+  const size_t words = (n + 63) / 64;
+  const bool canGoBottomUp = g.hasInEdges();
+  const size_t alpha = options.alpha ? options.alpha : 1;
+  const size_t beta = options.beta ? options.beta : 1;
+
+  std::vector<uint64_t> frontierBits;
+  std::vector<uint64_t> nextBits;
+  size_t frontierBegin = 0; // frontier = order[frontierBegin..)
+  size_t previousSize = 0;
+  size_t frontierEdges = g.degree(source);
+  size_t unexploredEdges = g.edges() - frontierEdges;
+  bool bottomUp = false;
+
+  for (size_t level = 0; frontierBegin < tree.order.size(); ++level) {
+    const size_t frontierEnd = tree.order.size();
+    const size_t frontierSize = frontierEnd - frontierBegin;
+
+    if (!bottomUp && canGoBottomUp &&
+        frontierEdges > unexploredEdges / alpha) {
+      bottomUp = true;
+    } else if (bottomUp && frontierSize < previousSize &&
+               frontierSize < n / beta) {
+      bottomUp = false;
+    }
+    previousSize = frontierSize;
+
+    size_t nextEdges = 0;
+    if (bottomUp) {
+      frontierBits.assign(words, 0);
+      for (size_t i = frontierBegin; i < frontierEnd; ++i)
+        detail::setBit(frontierBits, tree.order[i]);
+      nextBits.assign(words, 0);
+      for (size_t v = 0; v < n; ++v) {
+        if (tree.depth[v] != UNREACHED)
+          continue;
+        for (size_t e = g.inOffsets[v]; e < g.inOffsets[v + 1]; ++e) {
+          size_t u = g.inTargets[e];
+          if (detail::testBit(frontierBits, u)) {
+            tree.parent[v] = u;
+            detail::setBit(nextBits, v);
+            break;
+          }
+        }
+      }
+      // Append this level's discoveries in index order.
+      for (size_t w = 0; w < words; ++w) {
+        for (uint64_t bits = nextBits[w]; bits; bits &= bits - 1) {
+          size_t v = w * 64 + detail::lowestBit(bits);
+          tree.depth[v] = level + 1;
+          tree.order.push_back(v);
+          nextEdges += g.degree(v);
+        }
+      }
+    } else {
+      for (size_t i = frontierBegin; i < frontierEnd; ++i) {
+        size_t u = tree.order[i];
+        for (size_t e = g.offsets[u]; e < g.offsets[u + 1]; ++e) {
+          size_t v = g.targets[e];
+          if (tree.depth[v] == UNREACHED) {
+            tree.depth[v] = level + 1;
+            tree.parent[v] = u;
+            tree.order.push_back(v);
+            nextEdges += g.degree(v);
+          }
+        }
+      }
+    }
+
+    frontierBegin = frontierEnd;
+    frontierEdges = nextEdges;
+    unexploredEdges -= std::min(unexploredEdges, nextEdges);
+  }
+  return tree;
+}
+
+/**
+ * @brief Level-synchronous parallel BFS; the result is identical to
+ * queueBFS (same order, depths and parents).
+ *
+ * Each level lays the frontier's out-edges end to end and cuts them into
+ * equal-sized chunks, so a hub's row is shared among workers instead of
+ * stalling one of them. Expansion takes two passes over the chunks:
+ *
+ *   1. For every edge to a vertex not yet in the visited bitmap, lower the
+ *      vertex's claim to the edge's position with an atomic min.
+ *   2. The edge holding a vertex's final claim (its first occurrence, which
+ *      is where queueBFS finds it) sets its depth and parent, marks it
+ *      visited and appends it to the chunk's local queue.
+ *
+ * Concatenating the local queues in chunk order yields the next frontier
+ * in queueBFS order. Small levels are expanded on the calling thread.
+ *
+ * @complexity O(V + E) work, two edge scans and one set of worker threads
+ * per parallel level.
+ */
+inline BFSTree parallelBFS(const CSRView &g, size_t source,
+                           const ParallelBFSOptions &options = {}) {
+  BFSTree tree = detail::startTree(g, source);
+  const size_t n = g.vertices;
+
+  std::vector<std::atomic<uint64_t>> visited((n + 63) / 64);
+  detail::setBit(visited, source);
+  // Claims are positions in the edges of all levels so far, so a claim
+  // left over from an earlier level never matches a later position.
+  std::vector<std::atomic<size_t>> claim(n);
+  for (auto &slot : claim)
+    slot.store(UNREACHED, std::memory_order_relaxed);
+
+  std::vector<size_t> edgeStart;
+  std::vector<std::vector<size_t>> local;
+  size_t base = 0;
+  for (size_t level = 0, begin = 0; begin < tree.order.size(); ++level) {
+    const size_t end = tree.order.size();
+    const size_t *frontier = tree.order.data() + begin;
+    edgeStart.assign(end - begin + 1, 0);
+    for (size_t k = 0; k < end - begin; ++k)
+      edgeStart[k + 1] = edgeStart[k] + g.degree(frontier[k]);
+    const size_t total = edgeStart.back();
+    const size_t workers = PeakStore::workerCount(
+        total, options.minEdgesPerWorker, options.workers);
+
+    if (workers <= 1) {
+      for (size_t k = 0; k < end - begin; ++k) {
+        size_t u = frontier[k];
+        for (size_t e = g.offsets[u]; e < g.offsets[u + 1]; ++e) {
+          size_t v = g.targets[e];
+          if (tree.depth[v] == UNREACHED) {
+            tree.depth[v] = level + 1;
+            tree.parent[v] = u;
+            detail::setBit(visited, v);
+            tree.order.push_back(v);
+          }
+        }
+      }
+      begin = end;
+      base += total;
+      continue;
+    }
+
+    const size_t wanted = workers * PARALLEL_BFS_CHUNKS_PER_WORKER;
+    const size_t chunkEdges = (total + wanted - 1) / wanted;
+    const size_t chunks = (total + chunkEdges - 1) / chunkEdges;
+    // Calls visit(chunk, position, u, v) for every frontier edge u -> v of
+    // the chunks this worker takes from next.
+    auto scanChunks = [&](std::atomic<size_t> &next, auto &&visit) {
+      size_t c;
+      while ((c = next.fetch_add(1, std::memory_order_relaxed)) < chunks) {
+        size_t p = c * chunkEdges;
+        const size_t last = std::min(total, p + chunkEdges);
+        size_t k = static_cast<size_t>(
+            std::upper_bound(edgeStart.begin(), edgeStart.end(), p) -
+            edgeStart.begin() - 1);
+        while (p < last) {
+          while (edgeStart[k + 1] <= p)
+            ++k;
+          const size_t u = frontier[k];
+          // Edge p of the level is targets[shift + p] (mod 2^64).
+          const size_t shift = g.offsets[u] - edgeStart[k];
+          for (const size_t stop = std::min(last, edgeStart[k + 1]); p < stop;
+               ++p)
+            visit(c, base + p, u, g.targets[shift + p]);
+        }
+      }
+    };
+
+    local.resize(chunks);
+    for (auto &queue : local)
+      queue.clear();
+    // Both passes run on the same workers; the barrier makes every claim
+    // final before any worker checks one.
+    std::atomic<size_t> nextClaim{0}, nextFill{0};
+    PeakStore::Barrier barrier(workers);
+    PeakStore::parallelFor(workers, workers, [&](size_t, size_t, size_t) {
+      scanChunks(nextClaim, [&](size_t, size_t p, size_t, size_t v) {
+        if (!detail::testBit(visited, v))
+          detail::atomicMin(claim[v], p);
+      });
+      barrier.wait();
+      scanChunks(nextFill, [&](size_t c, size_t p, size_t u, size_t v) {
+        if (claim[v].load(std::memory_order_relaxed) != p)
+          return;
+        tree.depth[v] = level + 1;
+        tree.parent[v] = u;
+        detail::setBit(visited, v);
+        local[c].push_back(v);
+      });
+    });
+    for (size_t c = 0; c < chunks; ++c)
+      tree.order.insert(tree.order.end(), local[c].begin(), local[c].end());
+    begin = end;
+    base += total;
+  }
+  return tree;
+}
+
+} // namespace Algorithms
+} // namespace CinderPeak
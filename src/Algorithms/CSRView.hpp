@@ -0,0 +1,30 @@
+#pragma once
+#include <cstddef>
+
+namespace CinderPeak {
+namespace Algorithms {
+
+/**
+ * @brief Read-only view of a graph in compressed sparse row form.
+ *
+ * Vertices are dense indices 0..vertices-1. The out-neighbors of v are
+ * targets[offsets[v] .. offsets[v + 1]). inOffsets/inTargets hold the
+ * transpose (in-neighbors) when the producer was asked for it; on
+ * undirected graphs they alias the out arrays. The view does not own the
+ * arrays and is only valid while the producer's lock is held.
+ */
+struct CSRView {
+  size_t vertices = 0;
+  const size_t *offsets = nullptr;
+  const size_t *targets = nullptr;
+  const size_t *inOffsets = nullptr;
+  const size_t *inTargets = nullptr;
+
+  size_t edges() const { return vertices ? offsets[vertices] : 0; }
+  size_t degree(size_t v) const { return offsets[v + 1] - offsets[v]; }
+  size_t inDegree(size_t v) const { return inOffsets[v + 1] - inOffsets[v]; }
+  bool hasInEdges() const { return inOffsets != nullptr; }
+};
+
+} // namespace Algorithms
+} // namespace CinderPeak
@@ -1,212 +1,33 @@
 #pragma once
+#include "Algorithms/BFS.hpp"
+#include "Algorithms/CSRView.hpp"
+#include "Algorithms/ConnectedComponents.hpp"
+#include "Algorithms/PageRank.hpp"
+#include "Algorithms/ShortestPaths.hpp"
+#include "Algorithms/StronglyConnectedComponents.hpp"
+#include "Algorithms/TriangleCount.hpp"
 #include "Result/bfs_result.hpp"
+#include "Result/components_result.hpp"
+#include "Result/pagerank_result.hpp"
+#include "Result/scc_result.hpp"
+#include "Result/shortest_path_result.hpp"
+#include "Result/triangle_result.hpp"
 #include <iostream>
 #include <memory>
+#include <optional>
 namespace CinderPeak {
 namespace PeakStore {
 template <typename VertexType, typename EdgeType> class HybridCSR_COO;
 
 }
 /*
-================================================================================
-                                CINDERPEAK NOTE
-================================================================================
-
-    Algorithms Module Status:
-    ------------------------------------------------------------------------
-
-    The CinderPeak Algorithms Module is currently NOT implemented and is
-    intentionally kept as a stub.
-
-    This decision is deliberate and design-driven rather than a missing
-    feature or unfinished placeholder. The algorithms subsystem requires a
-    highly detailed architectural plan before implementation can begin.
-
-    ------------------------------------------------------------------------
-    Background
-    ------------------------------------------------------------------------
-
-    CinderPeak internally uses multiple graph storage representations:
-
-        1. Adjacency List Storage
-        2. Hybrid Storage (optimized traversal/storage structure)
-
-    The primary challenge is NOT implementing algorithms like:
-
-        - BFS
-        - DFS
-        - Dijkstra
-        - PageRank
-        - Connected Components
-        - Centrality Algorithms
-        - Traversal Utilities
-
-    The real challenge is designing a reliable synchronization and
-    coordination mechanism between the storage backends.
-
-    ------------------------------------------------------------------------
-    Source of Truth Problem
-    ------------------------------------------------------------------------
-
-    The adjacency list currently acts as the canonical source of truth.
-
-    All graph mutations are performed on the adjacency storage:
-
-        - Vertex insertions
-        - Edge insertions
-        - Vertex removals
-        - Edge removals
-        - Property updates
-
-    However, traversal-heavy algorithms are expected to operate on the
-    Hybrid Storage because it is designed for optimized access patterns.
-
-    This creates a major architectural question:
-
-        "When should the hybrid storage be rebuilt or synchronized?"
-
-    Example scenario:
-
-        1. User performs graph mutations.
-        2. Hybrid storage becomes outdated ("dirty").
-        3. User invokes BFS/DFS.
-        4. System must decide:
-
-            a) Rebuild hybrid storage before traversal
-            b) Use stale hybrid storage
-            c) Incrementally synchronize changes
-            d) Maintain continuous synchronization
-
-    Each approach has tradeoffs involving:
-
-        - Memory usage
-        - Rebuild cost
-        - Traversal performance
-        - Synchronization complexity
-        - Thread safety
-        - Lock contention
-
-    ------------------------------------------------------------------------
-    Concurrency & Locking Challenges
-    ------------------------------------------------------------------------
-
-    Another major blocker is concurrency management.
-
-    Consider the following scenario:
-
-        Thread A:
-            Running BFS traversal on Hybrid Storage
-
-        Thread B:
-            Performing edge insertions/removals simultaneously
-
-    Questions that still require architectural decisions:
-
-        - Should traversals acquire read locks?
-        - Should writes block traversals?
-        - Should mutations be buffered temporarily?
-        - Should traversals operate on immutable snapshots?
-        - Should dirty-region synchronization exist?
-        - Should lock-free mechanisms be introduced?
-        - How should consistency guarantees be maintained?
-
-    One proposed idea is:
-
-        - During traversal execution:
-              Incoming writes are redirected into a temporary buffer.
-
-        - After traversal completion:
-              Buffered operations are merged back into adjacency storage.
-
-    However, this introduces additional complexity:
-
-        - Merge ordering
-        - Conflict resolution
-        - Snapshot validity
-        - Buffer ownership
-        - Synchronization overhead
-        - Cache invalidation logic
-
-    ------------------------------------------------------------------------
-    Current Development Priority
-    ------------------------------------------------------------------------
-
-    The immediate focus of the project is improving:
-
-        PeakStore.hpp
-
-    Specifically:
-
-        - Event-driven architecture redesign
-        - Constraint system redesign
-        - Reduction of orchestration complexity
-        - Removal of duplicated orchestration logic
-        - Cleaner storage abstraction boundaries
-        - Better lifecycle/event handling
-
-    Currently PeakStore is responsible for handling a large amount of
-    orchestration logic and some parts have become difficult to maintain.
-
-    Before algorithms can be implemented properly, PeakStore must evolve
-    into a cleaner orchestration layer capable of managing:
-
-        - Storage synchronization
-        - Traversal execution
-        - Event dispatching
-        - Constraint enforcement
-        - Algorithm lifecycle management
-        - Concurrency coordination
-
-    The long-term plan is for PeakStore to become the central controller
-    responsible for safely coordinating storages and algorithms.
-
-    ------------------------------------------------------------------------
-    Community Contribution Suggestion
-    ------------------------------------------------------------------------
-
-    Current graph implementation supports:
-
-        - Parallel edges
-
-    Planned change:
-
-        - Remove support for self-loops/self-edges entirely.
-
-    Contributors are encouraged to open issues or PRs that remove all traces
-    of self-edge logic from the codebase, including:
-
-        - Storage layer logic
-        - Validation logic
-        - Tests
-        - Examples
-        - Orchestrator logic
-        - Utility helpers
-        - Edge insertion checks
-
-    This cleanup would simplify future algorithmic assumptions and reduce
-    architectural complexity.
-
-    ------------------------------------------------------------------------
-    Final Note
-    ------------------------------------------------------------------------
-
-    The absence of the algorithms module is intentional.
-
-    The goal is NOT to implement algorithms quickly, but to design an
-    architecture that can support:
-
-        - High performance
-        - Safe concurrency
-        - Multi-storage synchronization
-        - Scalable traversal systems
-        - Future distributed execution capabilities
-        - Maintainable long-term design
-
-    Until the orchestration and synchronization architecture is finalized,
-    the algorithms module will remain a stub by design.
-
-================================================================================
-*/
+ * Algorithms run over the hybrid CSR, never over the adjacency list.
+ *
+ * Every mutation event sets GraphContext::hybrid_stale. Before a traversal,
+ * PeakStore::syncHybridStorage() reloads the hybrid CSR from the adjacency
+ * list if the flag was set, and the algorithm then reads dense arrays
+ * through HybridCSR_COO::withCSR / withWeightedCSR under its read lock.
+ */
 namespace Algorithms {
 template <typename VertexType, typename EdgeType> class CinderPeakAlgorithms {
 public:
@@ -216,15 +37,183 @@ public:
       const std::shared_ptr<PeakStore::HybridCSR_COO<VertexType, EdgeType>>
           &hybridcsr)
       : hcsr(hybridcsr) {}
-  BFSResult<VertexType> bfs([[maybe_unused]] const VertexType &src) {
-    std::cout << "Algorithms::bfs called\n";
 
-    BFSResult<VertexType> result;
-    result.order_.push_back(1);
-    result.order_.push_back(2);
-    result.order_.push_back(3);
-    result.order_.push_back(4);
-    return result;
+  /**
+   * @brief Direction-optimizing BFS from src over the hybrid CSR.
+   *
+   * @param directed Whether bottom-up steps need the transposed CSR.
+   */
+  BFSResult<VertexType> bfs(const VertexType &src, bool directed) {
+    return runBFS(src, directed, [](const CSRView &g, size_t source) {
+      return directionOptimizingBFS(g, source);
+    });
+  }
+
+  /**
+   * @brief Parallel level-synchronous BFS from src over the hybrid CSR.
+   *
+   * Same order, depths and parents as a serial queue BFS.
+   */
+  BFSResult<VertexType> parallelBFS(const VertexType &src, bool directed,
+                                    const ParallelBFSOptions &options) {
+    return runBFS(src, directed, [&](const CSRView &g, size_t source) {
+      return Algorithms::parallelBFS(g, source, options);
+    });
+  }
+
+  /**
+   * @brief Single-source shortest paths from src over the weighted CSR.
+   *
+   * Runs dijkstra(), or deltaStepping() when options is given. Negative
+   * weights are rejected with InvalidArgument.
+   */
+  ShortestPathResult<VertexType, EdgeType>
+  shortestPaths(const VertexType &src, bool directed,
+                const std::optional<DeltaSteppingOptions> &options) {
+    return hcsr->withWeightedCSR(directed, [&](const CSRView &g,
+                                               const EdgeType *weights,
+                                               const auto &map) {
+      ShortestPathResult<VertexType, EdgeType> result;
+      auto source = map.index(src);
+      if (!source) {
+        result._status = PeakStatus::VertexNotFound(
+            "Vertex Not Found During the shortest path search");
+        return result;
+      }
+      if (detail::hasNegativeWeight(g, weights)) {
+        result._status = PeakStatus::InvalidArgument(
+            "Shortest paths need non-negative edge weights");
+        return result;
+      }
+      auto tree = options ? deltaStepping(g, weights, *source, *options)
+                          : dijkstra(g, weights, *source);
+      result.distance_ = std::move(tree.distance);
+      result.predecessor_ = std::move(tree.predecessor);
+      result.source_ = *source;
+      fillVertices(result, map);
+      return result;
+    });
+  }
+
+  /**
+   * @brief Pull-based PageRank over the in-edges of the hybrid CSR.
+   *
+   * @param directed Whether the in-edges need the transposed CSR.
+   */
+  PageRankResult<VertexType> pageRank(double damping, double tolerance,
+                                      size_t maxIterations, bool directed) {
+    if (!(damping >= 0 && damping < 1))
+      return PageRankResult<VertexType>(
+          PeakStatus::InvalidArgument("PageRank damping must be in [0, 1)"));
+    return hcsr->withCSR(directed, [&](const CSRView &g, const auto &map) {
+      PageRankOptions options;
+      options.damping = damping;
+      options.tolerance = tolerance;
+      options.maxIterations = maxIterations;
+      PageRankScores scores = Algorithms::pageRank(g, options);
+      PageRankResult<VertexType> result;
+      result.ranks_ = std::move(scores.rank);
+      result.iterationSeconds_ = std::move(scores.iterationSeconds);
+      result.iterations_ = scores.iterations;
+      result.error_ = scores.error;
+      result.converged_ = scores.converged;
+      fillVertices(result, map);
+      return result;
+    });
+  }
+
+  /**
+   * @brief Connected components with Afforest.
+   *
+   * @param directed Whether the graph is directed; its components are then
+   *        weak and need the transposed CSR.
+   */
+  ComponentsResult<VertexType> connectedComponents(bool directed) {
+    return hcsr->withCSR(directed, [&](const CSRView &g, const auto &map) {
+      ComponentLabels labels = Algorithms::connectedComponents(g);
+      ComponentsResult<VertexType> result;
+      result.component_ = std::move(labels.component);
+      result.sizes_ = std::move(labels.sizes);
+      fillVertices(result, map);
+      return result;
+    });
+  }
+
+  /**
+   * @brief Strongly connected components over the out-edges, plus the
+   * condensation DAG.
+   *
+   * Runs the iterative Tarjan, or the parallel trim / forward-backward /
+   * coloring kernel (on the transposed CSR) when options is given.
+   */
+  StrongComponentsResult<VertexType>
+  stronglyConnectedComponents(bool directed,
+                              const std::optional<SCCOptions> &options) {
+    // Tarjan only walks out-edges, so it skips building the transpose.
+    const bool needsInEdges = directed && options.has_value();
+    return hcsr->withCSR(needsInEdges, [&](const CSRView &g,
+                                           const auto &map) {
+      StrongComponents scc =
+          options ? Algorithms::parallelStronglyConnectedComponents(g, *options)
+                  : Algorithms::stronglyConnectedComponents(g);
+      StrongComponentsResult<VertexType> result;
+      result.component_ = std::move(scc.component);
+      result.sizes_ = std::move(scc.sizes);
+      result.dagOffsets_ = std::move(scc.dagOffsets);
+      result.dagTargets_ = std::move(scc.dagTargets);
+      fillVertices(result, map);
+      return result;
+    });
+  }
+
+  /**
+   * @brief Triangle counts and local clustering over the undirected
+   * simple graph underneath the CSR.
+   *
+   * @param directed Whether in-edges must come from the transposed CSR.
+   */
+  TriangleCountResult<VertexType> countTriangles(bool directed) {
+    return hcsr->withCSR(directed, [&](const CSRView &g, const auto &map) {
+      TriangleCounts counts = Algorithms::countTriangles(g);
+      TriangleCountResult<VertexType> result;
+      result.triangles_ = std::move(counts.triangles);
+      result.clustering_ = std::move(counts.clustering);
+      result.total_ = counts.total;
+      fillVertices(result, map);
+      return result;
+    });
+  }
+
+private:
+  template <typename Map>
+  static void fillVertices(IndexedVertices<VertexType> &result,
+                           const Map &map) {
+    result.table_ = map.table();
+  }
+
+  // Runs traverse(view, sourceIndex) and maps the tree back to vertices.
+  template <typename Traverse>
+  BFSResult<VertexType> runBFS(const VertexType &src, bool directed,
+                               Traverse &&traverse) {
+    return hcsr->withCSR(directed, [&](const CSRView &g, const auto &map) {
+      BFSResult<VertexType> result;
+      auto source = map.index(src);
+      if (!source) {
+        result._status =
+            PeakStatus::VertexNotFound("Vertex Not Found During the BFS");
+        return result;
+      }
+      BFSTree tree = traverse(g, *source);
+      result.order_.reserve(tree.order.size());
+      result.depth_.reserve(tree.order.size());
+      result.parent_.reserve(tree.order.size());
+      for (size_t v : tree.order) {
+        result.order_.push_back(map.value(v));
+        result.depth_.push_back(tree.depth[v]);
+        result.parent_.push_back(map.value(tree.parent[v]));
+      }
+      return result;
+    });
   }
 };
 } // namespace Algorithms
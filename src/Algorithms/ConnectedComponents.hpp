@@ -0,0 +1,170 @@
+#pragma once
+#include "Algorithms/CSRView.hpp"
+#include "StorageEngine/ParallelUtils.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+namespace CinderPeak {
+namespace Algorithms {
+
+struct ComponentsOptions {
+  // Neighbors per vertex linked before sampling the largest component.
+  size_t neighborRounds = 2;
+  // Worker threads; 0 uses one per hardware thread.
+  size_t workers = 0;
+  // Minimum rows plus edges per worker, as for PeakStore::workerCount.
+  size_t minWorkPerWorker = PeakStore::MIN_ITEMS_PER_WORKER;
+};
+
+/**
+ * @brief Component labels over the dense indices of a CSRView.
+ *
+ * Labels are 0..sizes.size()-1, numbered in order of each component's
+ * lowest vertex index; sizes[c] counts the vertices labelled c.
+ */
+struct ComponentLabels {
+  std::vector<size_t> component;
+  std::vector<size_t> sizes;
+};
+
+// Vertices per chunk claimed by a worker in the component passes.
+inline constexpr size_t COMPONENTS_CHUNK = 1024;
+// Labels sampled to guess the largest component.
+inline constexpr size_t COMPONENTS_SAMPLES = 1024;
+
+namespace detail {
+
+// Hooks the trees of u and v together: the higher root points at the
+// lower one, so a root only ever moves to a smaller index.
+inline void link(std::vector<std::atomic<size_t>> &parent, size_t u,
+                 size_t v) {
+  size_t p1 = parent[u].load(std::memory_order_relaxed);
+  size_t p2 = parent[v].load(std::memory_order_relaxed);
+  while (p1 != p2) {
+    size_t high = std::max(p1, p2);
+    size_t low = std::min(p1, p2);
+    size_t highParent = parent[high].load(std::memory_order_relaxed);
+    if (highParent == low)
+      break;
+    if (highParent == high &&
+        parent[high].compare_exchange_strong(highParent, low,
+                                             std::memory_order_relaxed))
+      break;
+    p1 = parent[parent[high].load(std::memory_order_relaxed)].load(
+        std::memory_order_relaxed);
+    p2 = parent[low].load(std::memory_order_relaxed);
+  }
+}
+
+// Points every vertex of [begin, end) straight at its root.
+inline void compress(std::vector<std::atomic<size_t>> &parent, size_t begin,
+                     size_t end) {
+  for (size_t v = begin; v < end; ++v) {
+    size_t p = parent[v].load(std::memory_order_relaxed);
+    size_t pp = parent[p].load(std::memory_order_relaxed);
+    while (p != pp) {
+      p = pp;
+      pp = parent[p].load(std::memory_order_relaxed);
+    }
+    parent[v].store(p, std::memory_order_relaxed);
+  }
+}
+
+} // namespace detail
+
+/**
+ * @brief Connected components with Afforest (Sutton et al., IPDPS'18).
+ *
+ * Every vertex first links to its first neighborRounds neighbors, which
+ * is usually enough to assemble the giant component. A sample of labels
+ * then names the most common root, and the remaining edges are only
+ * scanned for vertices outside it. Links are lock-free: a compare-and-swap
+ * hooks one root under the other.
+ *
+ * When the view carries a separate transpose (directed graphs) the last
+ * pass also links in-edges, which yields weakly connected components.
+ *
+ * @complexity O(V + E) work, usually far fewer edges for skewed graphs.
+ */
+inline ComponentLabels connectedComponents(
+    const CSRView &g, const ComponentsOptions &options = {}) {
+  const size_t n = g.vertices;
+  const size_t workers = PeakStore::workerCount(
+      n + g.edges(), options.minWorkPerWorker, options.workers);
+  const bool directed = g.hasInEdges() && g.inOffsets != g.offsets;
+
+  std::vector<std::atomic<size_t>> parent(n);
+  for (size_t v = 0; v < n; ++v)
+    parent[v].store(v, std::memory_order_relaxed);
+  auto compressAll = [&] {
+    PeakStore::parallelForDynamic(n, workers, COMPONENTS_CHUNK,
+                                  [&](size_t, size_t begin, size_t end) {
+                                    detail::compress(parent, begin, end);
+                                  });
+  };
+
+  for (size_t round = 0; round < options.neighborRounds; ++round) {
+    PeakStore::parallelForDynamic(
+        n, workers, COMPONENTS_CHUNK, [&](size_t, size_t begin, size_t end) {
+          for (size_t u = begin; u < end; ++u)
+            if (round < g.degree(u))
+              detail::link(parent, u, g.targets[g.offsets[u] + round]);
+        });
+    compressAll();
+  }
+
+  // The most common root among a few samples is almost surely the giant
+  // component, whose vertices need no further scanning.
+  size_t largest = 0;
+  if (n > 0) {
+    std::mt19937_64 rng(27491095);
+    std::uniform_int_distribution<size_t> pick(0, n - 1);
+    std::unordered_map<size_t, size_t> counts;
+    size_t best = 0;
+    for (size_t i = 0; i < COMPONENTS_SAMPLES; ++i) {
+      size_t root = parent[pick(rng)].load(std::memory_order_relaxed);
+      if (++counts[root] > best) {
+        best = counts[root];
+        largest = root;
+      }
+    }
+  }
+
+  PeakStore::parallelForDynamic(
+      n, workers, COMPONENTS_CHUNK, [&](size_t, size_t begin, size_t end) {
+        for (size_t u = begin; u < end; ++u) {
+          if (parent[u].load(std::memory_order_relaxed) == largest)
+            continue;
+          for (size_t e = g.offsets[u] + options.neighborRounds;
+               e < g.offsets[u + 1]; ++e)
+            detail::link(parent, u, g.targets[e]);
+          if (directed)
+            for (size_t e = g.inOffsets[u]; e < g.inOffsets[u + 1]; ++e)
+              detail::link(parent, u, g.inTargets[e]);
+        }
+      });
+  compressAll();
+
+  // Roots are the lowest index of their component, so labelling in index
+  // order numbers components by their lowest vertex.
+  ComponentLabels labels;
+  labels.component.resize(n);
+  std::vector<size_t> labelOfRoot(n, SIZE_MAX);
+  for (size_t v = 0; v < n; ++v) {
+    size_t root = parent[v].load(std::memory_order_relaxed);
+    if (labelOfRoot[root] == SIZE_MAX) {
+      labelOfRoot[root] = labels.sizes.size();
+      labels.sizes.push_back(0);
+    }
+    labels.component[v] = labelOfRoot[root];
+    ++labels.sizes[labelOfRoot[root]];
+  }
+  return labels;
+}
+
+} // namespace Algorithms
+} // namespace CinderPeak
@@ -10,7 +10,12 @@ public:
       : _status(std::move(status)) {}
 
   bool isOK() { return _status.isOK(); }
+  // Reached vertices level by level, the source first.
   std::vector<VertexType> order_;
+  // depth_[i] and parent_[i] belong to order_[i]; the source is its own
+  // parent.
+  std::vector<size_t> depth_;
+  std::vector<VertexType> parent_;
   PeakStatus _status;
 };
 } // namespace Algorithms
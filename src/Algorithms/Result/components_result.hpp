@@ -0,0 +1,46 @@
+#pragma once
+#include "Algorithms/Result/indexed_vertices.hpp"
+#include "StorageEngine/ErrorCodes.hpp"
+#include <optional>
+#include <vector>
+
+namespace CinderPeak {
+namespace Algorithms {
+/**
+ * @brief Connected components, indexed by CSR vertex index.
+ *
+ * component_[i] is the component id of vertex i; ids run from 0 to
+ * count() - 1 in order of each component's first vertex, and sizes_[c]
+ * counts the vertices in component c.
+ */
+template <typename VertexType>
+class ComponentsResult : public IndexedVertices<VertexType> {
+public:
+  explicit ComponentsResult(PeakStatus status = PeakStatus::OK())
+      : _status(std::move(status)) {}
+
+  bool isOK() const { return _status.isOK(); }
+
+  std::vector<size_t> component_;
+  std::vector<size_t> sizes_;
+  PeakStatus _status;
+
+  size_t count() const { return sizes_.size(); }
+
+  // Component id of v, or nullopt if v is not in the graph.
+  std::optional<size_t> componentOf(const VertexType &v) const {
+    auto idx = this->index(v);
+    if (!idx)
+      return std::nullopt;
+    return component_[*idx];
+  }
+
+  // Whether a and b are both in the graph and in the same component.
+  bool sameComponent(const VertexType &a, const VertexType &b) const {
+    auto ca = componentOf(a);
+    return ca && ca == componentOf(b);
+  }
+};
+} // namespace Algorithms
+
+} // namespace CinderPeak
@@ -0,0 +1,65 @@
+#pragma once
+#include "StorageEngine/Utils.hpp"
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+namespace CinderPeak {
+namespace Algorithms {
+/**
+ * @brief Vertex values by CSR vertex index.
+ *
+ * HybridCSR_COO builds one table per CSR version and every result taken
+ * from that version shares it. index(v) builds the reverse table on first
+ * use, so callers that only walk the dense arrays never pay for it.
+ */
+template <typename VertexType> class VertexTable {
+  mutable std::once_flag _built;
+  mutable std::unordered_map<VertexType, size_t, VertexHasher<VertexType>,
+                             VertexEqual<VertexType>>
+      _lookup;
+
+public:
+  std::vector<VertexType> vertices;
+
+  std::optional<size_t> index(const VertexType &v) const {
+    std::call_once(_built, [&] {
+      _lookup.reserve(vertices.size());
+      for (size_t i = 0; i < vertices.size(); ++i)
+        _lookup.emplace(vertices[i], i);
+    });
+    auto it = _lookup.find(v);
+    if (it == _lookup.end())
+      return std::nullopt;
+    return it->second;
+  }
+};
+
+/**
+ * @brief Maps a result's CSR vertex indices to vertices and back.
+ *
+ * Holds the shared VertexTable of the CSR the result was computed on, so
+ * producing a result copies no vertex values.
+ */
+template <typename VertexType> class IndexedVertices {
+  static const std::shared_ptr<const VertexTable<VertexType>> &empty() {
+    static const std::shared_ptr<const VertexTable<VertexType>> table =
+        std::make_shared<VertexTable<VertexType>>();
+    return table;
+  }
+
+public:
+  std::shared_ptr<const VertexTable<VertexType>> table_ = empty();
+
+  size_t size() const { return table_->vertices.size(); }
+  const VertexType &vertex(size_t idx) const { return table_->vertices[idx]; }
+
+  std::optional<size_t> index(const VertexType &v) const {
+    return table_->index(v);
+  }
+};
+} // namespace Algorithms
+
+} // namespace CinderPeak
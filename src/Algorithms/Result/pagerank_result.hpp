@@ -0,0 +1,40 @@
+#pragma once
+#include "Algorithms/Result/indexed_vertices.hpp"
+#include "StorageEngine/ErrorCodes.hpp"
+#include <optional>
+#include <vector>
+
+namespace CinderPeak {
+namespace Algorithms {
+/**
+ * @brief PageRank scores, indexed by CSR vertex index.
+ *
+ * ranks_ sums to 1. iterationSeconds_ holds the wall time of each
+ * iteration; error_ is the L1 change of the last one.
+ */
+template <typename VertexType>
+class PageRankResult : public IndexedVertices<VertexType> {
+public:
+  explicit PageRankResult(PeakStatus status = PeakStatus::OK())
+      : _status(std::move(status)) {}
+
+  bool isOK() const { return _status.isOK(); }
+
+  std::vector<float> ranks_;
+  std::vector<double> iterationSeconds_;
+  size_t iterations_ = 0;
+  double error_ = 0;
+  bool converged_ = false;
+  PeakStatus _status;
+
+  // Rank of v, or nullopt if v is not in the graph.
+  std::optional<float> rankOf(const VertexType &v) const {
+    auto idx = this->index(v);
+    if (!idx)
+      return std::nullopt;
+    return ranks_[*idx];
+  }
+};
+} // namespace Algorithms
+
+} // namespace CinderPeak
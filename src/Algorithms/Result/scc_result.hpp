@@ -0,0 +1,33 @@
+#pragma once
+#include "Algorithms/Result/components_result.hpp"
+#include "StorageEngine/ErrorCodes.hpp"
+#include <vector>
+
+namespace CinderPeak {
+namespace Algorithms {
+/**
+ * @brief Strongly connected components and their condensation DAG.
+ *
+ * Component ids follow ComponentsResult. The DAG has one node per
+ * component, in CSR form: the successors of component c are
+ * dagTargets_[dagOffsets_[c] .. dagOffsets_[c + 1]), sorted and free of
+ * duplicates.
+ */
+template <typename VertexType>
+class StrongComponentsResult : public ComponentsResult<VertexType> {
+public:
+  explicit StrongComponentsResult(PeakStatus status = PeakStatus::OK())
+      : ComponentsResult<VertexType>(std::move(status)) {}
+
+  std::vector<size_t> dagOffsets_;
+  std::vector<size_t> dagTargets_;
+
+  // Components that component c has an edge into.
+  std::vector<size_t> successors(size_t c) const {
+    return std::vector<size_t>(dagTargets_.begin() + dagOffsets_[c],
+                               dagTargets_.begin() + dagOffsets_[c + 1]);
+  }
+};
+} // namespace Algorithms
+
+} // namespace CinderPeak
@@ -0,0 +1,57 @@
+#pragma once
+#include "Algorithms/BFS.hpp"
+#include "Algorithms/Result/indexed_vertices.hpp"
+#include "StorageEngine/ErrorCodes.hpp"
+#include <algorithm>
+#include <optional>
+#include <vector>
+
+namespace CinderPeak {
+namespace Algorithms {
+/**
+ * @brief Single-source shortest paths, indexed by CSR vertex index.
+ *
+ * distance_ and predecessor_ keep the dense layout the search ran on; the
+ * IndexedVertices base maps indices to vertices and back.
+ */
+template <typename VertexType, typename EdgeType>
+class ShortestPathResult : public IndexedVertices<VertexType> {
+public:
+  explicit ShortestPathResult(PeakStatus status = PeakStatus::OK())
+      : _status(std::move(status)) {}
+
+  bool isOK() const { return _status.isOK(); }
+
+  // Indexed by CSR vertex index. Unreached vertices have an infinite (or
+  // maximal) distance and UNREACHED as predecessor; the source is its own.
+  std::vector<EdgeType> distance_;
+  std::vector<size_t> predecessor_;
+  size_t source_ = UNREACHED;
+  PeakStatus _status;
+
+  bool reached(size_t idx) const { return predecessor_[idx] != UNREACHED; }
+
+  // Distance to v, or nullopt if v is unknown or unreachable.
+  std::optional<EdgeType> distanceTo(const VertexType &v) const {
+    auto idx = this->index(v);
+    if (!idx || !reached(*idx))
+      return std::nullopt;
+    return distance_[*idx];
+  }
+
+  // Vertices from the source to v; empty if v is unknown or unreachable.
+  std::vector<VertexType> pathTo(const VertexType &v) const {
+    std::vector<VertexType> path;
+    auto idx = this->index(v);
+    if (!idx || !reached(*idx))
+      return path;
+    for (size_t at = *idx; at != source_; at = predecessor_[at])
+      path.push_back(this->vertex(at));
+    path.push_back(this->vertex(source_));
+    std::reverse(path.begin(), path.end());
+    return path;
+  }
+};
+} // namespace Algorithms
+
+} // namespace CinderPeak
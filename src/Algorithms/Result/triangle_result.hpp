@@ -0,0 +1,57 @@
+#pragma once
+#include "Algorithms/Result/indexed_vertices.hpp"
+#include "StorageEngine/ErrorCodes.hpp"
+#include <optional>
+#include <vector>
+
+namespace CinderPeak {
+namespace Algorithms {
+/**
+ * @brief Triangle counts and local clustering, indexed by CSR vertex index.
+ *
+ * triangles_[i] counts the triangles through vertex i and clustering_[i]
+ * the fraction of its neighbor pairs that are adjacent; total_ counts each
+ * triangle once.
+ */
+template <typename VertexType>
+class TriangleCountResult : public IndexedVertices<VertexType> {
+public:
+  explicit TriangleCountResult(PeakStatus status = PeakStatus::OK())
+      : _status(std::move(status)) {}
+
+  bool isOK() const { return _status.isOK(); }
+
+  std::vector<size_t> triangles_;
+  std::vector<double> clustering_;
+  size_t total_ = 0;
+  PeakStatus _status;
+
+  // Triangles through v, or nullopt if v is not in the graph.
+  std::optional<size_t> trianglesOf(const VertexType &v) const {
+    auto idx = this->index(v);
+    if (!idx)
+      return std::nullopt;
+    return triangles_[*idx];
+  }
+
+  // Local clustering coefficient of v, or nullopt if v is not in the graph.
+  std::optional<double> clusteringOf(const VertexType &v) const {
+    auto idx = this->index(v);
+    if (!idx)
+      return std::nullopt;
+    return clustering_[*idx];
+  }
+
+  // Mean local clustering coefficient over all vertices.
+  double averageClustering() const {
+    if (clustering_.empty())
+      return 0;
+    double sum = 0;
+    for (double c : clustering_)
+      sum += c;
+    return sum / static_cast<double>(clustering_.size());
+  }
+};
+} // namespace Algorithms
+
+} // namespace CinderPeak
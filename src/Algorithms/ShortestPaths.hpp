@@ -0,0 +1,327 @@
+#pragma once
+#include "Algorithms/BFS.hpp"
+#include "Algorithms/CSRView.hpp"
+#include "StorageEngine/ParallelUtils.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstddef>
+#include <deque>
+#include <limits>
+#include <mutex>
+#include <type_traits>
+#include <vector>
+
+namespace CinderPeak {
+namespace Algorithms {
+
+// Distance of a vertex the search did not reach.
+template <typename W> constexpr W unreachedDistance() {
+  if constexpr (std::numeric_limits<W>::has_infinity)
+    return std::numeric_limits<W>::infinity();
+  else
+    return std::numeric_limits<W>::max();
+}
+
+/**
+ * @brief Shortest-path tree over the dense indices of a CSRView.
+ *
+ * distance and predecessor are indexed by vertex. Unreached vertices hold
+ * unreachedDistance<W>() and UNREACHED; the source is its own predecessor.
+ */
+template <typename W> struct ShortestPathTree {
+  std::vector<W> distance;
+  std::vector<size_t> predecessor;
+};
+
+struct DeltaSteppingOptions {
+  // Bucket width; 0 picks max weight / average degree.
+  double delta = 0;
+  // Worker threads; 0 uses one per hardware thread.
+  size_t workers = 0;
+  // Minimum rows plus edges per worker, as for PeakStore::workerCount.
+  size_t minWorkPerWorker = PeakStore::MIN_ITEMS_PER_WORKER;
+};
+
+// Arity of the Dijkstra heap. Four children share a cache line of keys, so
+// sift-down touches half the lines a binary heap does.
+inline constexpr size_t DIJKSTRA_HEAP_ARITY = 4;
+
+namespace detail {
+
+/**
+ * @brief d-ary min-heap of vertex indices keyed by distance, with
+ * decrease-key through a position table.
+ */
+template <typename W, size_t D> class IndexedHeap {
+  static constexpr size_t NONE = SIZE_MAX;
+  std::vector<size_t> _heap;
+  std::vector<size_t> _pos;
+  const std::vector<W> &_key;
+
+  void place(size_t at, size_t v) {
+    _heap[at] = v;
+    _pos[v] = at;
+  }
+
+  void siftUp(size_t at) {
+    size_t v = _heap[at];
+    while (at > 0) {
+      size_t parent = (at - 1) / D;
+      if (!(_key[v] < _key[_heap[parent]]))
+        break;
+      place(at, _heap[parent]);
+      at = parent;
+    }
+    place(at, v);
+  }
+
+  void siftDown(size_t at) {
+    size_t v = _heap[at];
+    for (;;) {
+      size_t first = at * D + 1;
+      if (first >= _heap.size())
+        break;
+      size_t last = std::min(first + D, _heap.size());
+      size_t best = first;
+      for (size_t c = first + 1; c < last; ++c)
+        if (_key[_heap[c]] < _key[_heap[best]])
+          best = c;
+      if (!(_key[_heap[best]] < _key[v]))
+        break;
+      place(at, _heap[best]);
+      at = best;
+    }
+    place(at, v);
+  }
+
+public:
+  IndexedHeap(size_t n, const std::vector<W> &key) : _pos(n, NONE), _key(key) {}
+
+  bool empty() const { return _heap.empty(); }
+
+  // Inserts v, or restores heap order after its key was lowered.
+  void pushOrDecrease(size_t v) {
+    if (_pos[v] == NONE) {
+      _heap.push_back(v);
+      _pos[v] = _heap.size() - 1;
+    }
+    siftUp(_pos[v]);
+  }
+
+  size_t pop() {
+    size_t top = _heap.front();
+    _pos[top] = NONE;
+    size_t last = _heap.back();
+    _heap.pop_back();
+    if (!_heap.empty()) {
+      place(0, last);
+      siftDown(0);
+    }
+    return top;
+  }
+};
+
+template <typename W> bool hasNegativeWeight(const CSRView &g, const W *w) {
+  if constexpr (std::is_signed_v<W> || std::is_floating_point_v<W>) {
+    return std::any_of(w, w + g.edges(), [](W x) { return x < W{}; });
+  } else {
+    return false;
+  }
+}
+
+template <typename W>
+ShortestPathTree<W> startPathTree(const CSRView &g, size_t source) {
+  ShortestPathTree<W> tree;
+  tree.distance.assign(g.vertices, unreachedDistance<W>());
+  tree.predecessor.assign(g.vertices, UNREACHED);
+  tree.distance[source] = W{};
+  tree.predecessor[source] = source;
+  return tree;
+}
+
+} // namespace detail
+
+/**
+ * @brief Dijkstra's algorithm with a 4-ary indexed heap.
+ *
+ * weights[e] is the weight of edge targets[e] and must not be negative.
+ *
+ * @complexity O((V + E) log V)
+ */
+template <typename W>
+ShortestPathTree<W> dijkstra(const CSRView &g, const W *weights,
+                             size_t source) {
+  ShortestPathTree<W> tree = detail::startPathTree<W>(g, source);
+  auto &dist = tree.distance;
+  detail::IndexedHeap<W, DIJKSTRA_HEAP_ARITY> heap(g.vertices, dist);
+  heap.pushOrDecrease(source);
+  while (!heap.empty()) {
+    size_t u = heap.pop();
+    for (size_t e = g.offsets[u]; e < g.offsets[u + 1]; ++e) {
+      size_t v = g.targets[e];
+      W candidate = dist[u] + weights[e];
+      if (candidate < dist[v]) {
+        dist[v] = candidate;
+        tree.predecessor[v] = u;
+        heap.pushOrDecrease(v);
+      }
+    }
+  }
+  return tree;
+}
+
+/**
+ * @brief Parallel delta-stepping (Meyer and Sanders).
+ *
+ * Vertices are binned by floor(distance / delta). Workers drain the lowest
+ * non-empty bin together, relaxing every edge of each vertex and filing
+ * improved vertices into thread-local bins; the next round takes the
+ * lowest bin any worker holds. Vertices filed back into the current bin
+ * are picked up by the next round, so light edges settle within a bin.
+ *
+ * Relaxations read distances without locking and take the target's stripe
+ * lock only to store an improvement, so a predecessor always matches its
+ * distance. Distances equal dijkstra(); with ties the predecessor may
+ * differ.
+ *
+ * Graphs too small to give two workers minWorkPerWorker each run dijkstra()
+ * instead.
+ *
+ * @complexity O(V + E + bins * rounds) work for the usual weight
+ * distributions; a smaller delta means less repeated work but more rounds.
+ */
+template <typename W>
+ShortestPathTree<W> deltaStepping(const CSRView &g, const W *weights,
+                                  size_t source,
+                                  const DeltaSteppingOptions &options = {}) {
+  const size_t n = g.vertices;
+  const size_t workers = PeakStore::workerCount(
+      n + g.edges(), options.minWorkPerWorker, options.workers);
+  // One worker would only pay for the bins and barriers.
+  if (workers == 1)
+    return dijkstra(g, weights, source);
+  ShortestPathTree<W> tree = detail::startPathTree<W>(g, source);
+
+  double delta = options.delta;
+  if (!(delta > 0)) {
+    W heaviest = W{};
+    for (size_t e = 0; e < g.edges(); ++e)
+      heaviest = std::max(heaviest, weights[e]);
+    double degree =
+        n ? static_cast<double>(g.edges()) / static_cast<double>(n) : 1.0;
+    delta = static_cast<double>(heaviest) / std::max(1.0, degree);
+  }
+  if constexpr (std::is_integral_v<W>)
+    delta = std::max(1.0, std::floor(delta));
+  if (!(delta > 0))
+    delta = 1;
+  auto binOf = [delta](W d) {
+    return static_cast<size_t>(static_cast<double>(d) / delta);
+  };
+
+  std::vector<std::atomic<W>> dist(n);
+  for (auto &d : dist)
+    d.store(unreachedDistance<W>(), std::memory_order_relaxed);
+  dist[source].store(W{}, std::memory_order_relaxed);
+  constexpr size_t STRIPES = 1024;
+  std::vector<std::mutex> stripes(STRIPES);
+
+  std::vector<size_t> frontier{source};
+  std::vector<std::deque<std::vector<size_t>>> bins(workers);
+  std::vector<size_t> binSizes(workers);
+  std::atomic<size_t> nextChunk{0};
+  std::atomic<size_t> nextBin[2] = {SIZE_MAX, SIZE_MAX};
+  constexpr size_t CHUNK = 64;
+  PeakStore::Barrier barrier(workers);
+
+  PeakStore::parallelFor(workers, workers, [&](size_t w, size_t, size_t) {
+    // local[i] holds bin base + i. Bins below the current one are done and
+    // dropped, so a worker only keeps the window of bins still ahead.
+    auto &local = bins[w];
+    size_t base = 0;
+    size_t bin = 0;
+    size_t frontierSize = frontier.size();
+    for (size_t round = 0;; ++round) {
+      // Relax the current bin's vertices, claimed in chunks.
+      size_t c;
+      while ((c = nextChunk.fetch_add(CHUNK, std::memory_order_relaxed)) <
+             frontierSize) {
+        for (size_t i = c; i < std::min(c + CHUNK, frontierSize); ++i) {
+          size_t u = frontier[i];
+          W du = dist[u].load(std::memory_order_relaxed);
+          if (binOf(du) < bin)
+            continue; // filed again with a lower distance, already done
+          for (size_t e = g.offsets[u]; e < g.offsets[u + 1]; ++e) {
+            size_t v = g.targets[e];
+            W candidate = du + weights[e];
+            W current = dist[v].load(std::memory_order_relaxed);
+            if (!(candidate < current))
+              continue;
+            {
+              std::lock_guard<std::mutex> lock(stripes[v % STRIPES]);
+              current = dist[v].load(std::memory_order_relaxed);
+              if (!(candidate < current))
+                continue;
+              dist[v].store(candidate, std::memory_order_relaxed);
+              tree.predecessor[v] = u;
+            }
+            size_t target = binOf(candidate) - base;
+            if (target >= local.size())
+              local.resize(target + 1);
+            local[target].push_back(v);
+          }
+        }
+      }
+
+      size_t lowest = 0;
+      while (lowest < local.size() && local[lowest].empty())
+        ++lowest;
+      if (lowest < local.size()) {
+        lowest += base;
+        size_t seen = nextBin[round & 1].load(std::memory_order_relaxed);
+        while (lowest < seen && !nextBin[round & 1].compare_exchange_weak(
+                                    seen, lowest, std::memory_order_relaxed)) {
+        }
+      }
+      barrier.wait();
+
+      bin = nextBin[round & 1].load(std::memory_order_relaxed);
+      if (bin == SIZE_MAX)
+        break;
+      local.erase(local.begin(),
+                  local.begin() + std::min(local.size(), bin - base));
+      base = bin;
+      binSizes[w] = local.empty() ? 0 : local.front().size();
+      if (w == 0) {
+        nextBin[(round + 1) & 1].store(SIZE_MAX, std::memory_order_relaxed);
+        nextChunk.store(0, std::memory_order_relaxed);
+      }
+      barrier.wait();
+
+      size_t offset = 0;
+      frontierSize = 0;
+      for (size_t i = 0; i < workers; ++i) {
+        if (i < w)
+          offset += binSizes[i];
+        frontierSize += binSizes[i];
+      }
+      if (w == 0 && frontier.size() < frontierSize)
+        frontier.resize(frontierSize);
+      barrier.wait();
+      if (binSizes[w]) {
+        std::copy(local.front().begin(), local.front().end(),
+                  frontier.begin() + offset);
+        local.front().clear();
+      }
+      barrier.wait();
+    }
+  });
+
+  for (size_t v = 0; v < n; ++v)
+    tree.distance[v] = dist[v].load(std::memory_order_relaxed);
+  return tree;
+}
+
+} // namespace Algorithms
+} // namespace CinderPeak
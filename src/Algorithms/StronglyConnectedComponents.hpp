@@ -0,0 +1,357 @@
+#pragma once
+#include "Algorithms/CSRView.hpp"
+#include "Algorithms/ConnectedComponents.hpp"
+#include "StorageEngine/ParallelUtils.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace CinderPeak {
+namespace Algorithms {
+
+/**
+ * @brief Strongly connected components and their condensation.
+ *
+ * Labels follow ComponentLabels. The condensation DAG has one node per
+ * component: the successors of component c are
+ * dagTargets[dagOffsets[c] .. dagOffsets[c + 1]), sorted and without
+ * duplicates or self loops.
+ */
+struct StrongComponents : ComponentLabels {
+  std::vector<size_t> dagOffsets;
+  std::vector<size_t> dagTargets;
+};
+
+struct SCCOptions {
+  // Worker threads; 0 uses one per hardware thread.
+  size_t workers = 0;
+  // Minimum rows plus edges per worker, as for PeakStore::workerCount.
+  size_t minWorkPerWorker = PeakStore::MIN_ITEMS_PER_WORKER;
+  // Once fewer vertices than this are left, Tarjan finishes them serially.
+  size_t serialCutoff = size_t{1} << 12;
+};
+
+// Frontier vertices per chunk claimed by a worker in the reachability
+// passes.
+inline constexpr size_t SCC_FRONTIER_CHUNK = 256;
+// Trimming passes run before and after the pivot search.
+inline constexpr size_t SCC_TRIM_PASSES = 3;
+
+namespace detail {
+
+inline constexpr size_t NO_COMPONENT = SIZE_MAX;
+
+inline bool atomicMax(std::atomic<size_t> &slot, size_t value) {
+  size_t seen = slot.load(std::memory_order_relaxed);
+  while (seen < value)
+    if (slot.compare_exchange_weak(seen, value, std::memory_order_relaxed))
+      return true;
+  return false;
+}
+
+/**
+ * Tarjan's algorithm with an explicit call stack, so deep graphs cannot
+ * overflow the thread stack. Only vertices whose comp is NO_COMPONENT take
+ * part; each SCC found is labelled with its root vertex.
+ */
+inline void tarjan(const CSRView &g, std::vector<size_t> &comp) {
+  struct Frame {
+    size_t vertex;
+    size_t edge;
+  };
+  const size_t n = g.vertices;
+  std::vector<size_t> order(n, NO_COMPONENT), low(n);
+  std::vector<size_t> stack;
+  std::vector<Frame> calls;
+  size_t counter = 0;
+
+  auto visit = [&](size_t v) {
+    order[v] = low[v] = counter++;
+    stack.push_back(v);
+    calls.push_back({v, g.offsets[v]});
+  };
+
+  for (size_t root = 0; root < n; ++root) {
+    if (comp[root] != NO_COMPONENT || order[root] != NO_COMPONENT)
+      continue;
+    visit(root);
+    while (!calls.empty()) {
+      Frame &frame = calls.back();
+      const size_t v = frame.vertex;
+      if (frame.edge < g.offsets[v + 1]) {
+        // A labelled target is a finished SCC (or outside the run); an
+        // ordered, unlabelled one is still on the stack.
+        size_t w = g.targets[frame.edge++];
+        if (comp[w] != NO_COMPONENT)
+          continue;
+        if (order[w] == NO_COMPONENT)
+          visit(w);
+        else
+          low[v] = std::min(low[v], order[w]);
+        continue;
+      }
+      calls.pop_back();
+      if (!calls.empty())
+        low[calls.back().vertex] = std::min(low[calls.back().vertex], low[v]);
+      if (low[v] != order[v])
+        continue;
+      size_t w;
+      do {
+        w = stack.back();
+        stack.pop_back();
+        comp[w] = v;
+      } while (w != v);
+    }
+  }
+}
+
+/**
+ * Level-synchronous parallel search from frontier along (offsets, targets).
+ * claim(u, w) is called for each edge u -> w and returns true if this call
+ * took w, which then joins the next frontier.
+ */
+template <typename Claim>
+void parallelReach(const size_t *offsets, const size_t *targets,
+                   std::vector<size_t> frontier, size_t workers,
+                   Claim &&claim) {
+  std::vector<std::vector<size_t>> next(workers);
+  while (!frontier.empty()) {
+    PeakStore::parallelForDynamic(
+        frontier.size(), workers, SCC_FRONTIER_CHUNK,
+        [&](size_t w, size_t begin, size_t end) {
+          for (size_t i = begin; i < end; ++i) {
+            const size_t u = frontier[i];
+            for (size_t e = offsets[u]; e < offsets[u + 1]; ++e)
+              if (claim(u, targets[e]))
+                next[w].push_back(targets[e]);
+          }
+        });
+    frontier.clear();
+    for (auto &local : next) {
+      frontier.insert(frontier.end(), local.begin(), local.end());
+      local.clear();
+    }
+  }
+}
+
+// Renumbers raw labels densely by first vertex and builds the
+// condensation DAG.
+inline StrongComponents finishStrongComponents(const CSRView &g,
+                                               const std::vector<size_t> &raw) {
+  const size_t n = g.vertices;
+  StrongComponents result;
+  result.component.resize(n);
+  std::vector<size_t> labelOf(n, NO_COMPONENT);
+  for (size_t v = 0; v < n; ++v) {
+    size_t &label = labelOf[raw[v]];
+    if (label == NO_COMPONENT) {
+      label = result.sizes.size();
+      result.sizes.push_back(0);
+    }
+    result.component[v] = label;
+    ++result.sizes[label];
+  }
+
+  const size_t count = result.sizes.size();
+  auto &offsets = result.dagOffsets;
+  auto &targets = result.dagTargets;
+  offsets.assign(count + 1, 0);
+  for (size_t u = 0; u < n; ++u)
+    for (size_t e = g.offsets[u]; e < g.offsets[u + 1]; ++e)
+      if (result.component[u] != result.component[g.targets[e]])
+        ++offsets[result.component[u] + 1];
+  for (size_t c = 0; c < count; ++c)
+    offsets[c + 1] += offsets[c];
+  targets.resize(offsets[count]);
+  std::vector<size_t> fill(offsets.begin(), offsets.end() - 1);
+  for (size_t u = 0; u < n; ++u)
+    for (size_t e = g.offsets[u]; e < g.offsets[u + 1]; ++e) {
+      size_t from = result.component[u], to = result.component[g.targets[e]];
+      if (from != to)
+        targets[fill[from]++] = to;
+    }
+
+  // Sort each row and drop parallel edges, compacting in place.
+  size_t out = 0;
+  for (size_t c = 0; c < count; ++c) {
+    auto first = targets.begin() + static_cast<std::ptrdiff_t>(offsets[c]);
+    auto last = targets.begin() + static_cast<std::ptrdiff_t>(offsets[c + 1]);
+    std::sort(first, last);
+    offsets[c] = out;
+    for (auto it = first; it != last; ++it)
+      if (it == first || *it != *(it - 1))
+        targets[out++] = *it;
+  }
+  offsets[count] = out;
+  targets.resize(out);
+  return result;
+}
+
+} // namespace detail
+
+/**
+ * @brief Strongly connected components with iterative Tarjan.
+ *
+ * @complexity O(V + E), plus O(E log E) to build the condensation.
+ */
+inline StrongComponents stronglyConnectedComponents(const CSRView &g) {
+  std::vector<size_t> comp(g.vertices, detail::NO_COMPONENT);
+  detail::tarjan(g, comp);
+  return detail::finishStrongComponents(g, comp);
+}
+
+/**
+ * @brief Parallel strongly connected components (Multistep, Slota et
+ * al., IPDPS'14); needs the in-edges (g.hasInEdges()).
+ *
+ * 1. Trim: a vertex with no live in- or out-neighbor is its own SCC.
+ * 2. Forward-backward: the vertices forward-reachable from a high-degree
+ *    pivot that also reach it backwards form its SCC, usually the giant
+ *    one.
+ * 3. Coloring: every vertex takes the largest id that reaches it; each
+ *    color root's SCC is what reaches it backwards within its color.
+ *    Repeats on what is left.
+ * 4. Tarjan finishes once fewer than serialCutoff vertices remain.
+ *
+ * Labels and DAG match stronglyConnectedComponents().
+ *
+ * @complexity O((V + E) * rounds) work; coloring needs one propagation
+ * round per hop of the longest color path.
+ */
+inline StrongComponents
+parallelStronglyConnectedComponents(const CSRView &g,
+                                    const SCCOptions &options = {}) {
+  using detail::NO_COMPONENT;
+  constexpr auto relaxed = std::memory_order_relaxed;
+  const size_t n = g.vertices;
+  const size_t workers = PeakStore::workerCount(
+      n + g.edges(), options.minWorkPerWorker, options.workers);
+
+  std::vector<std::atomic<size_t>> comp(n);
+  std::vector<size_t> live(n);
+  for (size_t v = 0; v < n; ++v) {
+    comp[v].store(NO_COMPONENT, relaxed);
+    live[v] = v;
+  }
+  auto unlabelled = [&](size_t v) {
+    return comp[v].load(relaxed) == NO_COMPONENT;
+  };
+  auto dropLabelled = [&] {
+    live.erase(std::remove_if(live.begin(), live.end(),
+                              [&](size_t v) { return !unlabelled(v); }),
+               live.end());
+  };
+  auto hasLiveNeighbor = [&](const size_t *offsets, const size_t *targets,
+                             size_t v) {
+    for (size_t e = offsets[v]; e < offsets[v + 1]; ++e)
+      if (targets[e] != v && unlabelled(targets[e]))
+        return true;
+    return false;
+  };
+  auto trim = [&] {
+    for (size_t pass = 0; pass < SCC_TRIM_PASSES; ++pass) {
+      std::atomic<bool> trimmed{false};
+      PeakStore::parallelForDynamic(
+          live.size(), workers, SCC_FRONTIER_CHUNK,
+          [&](size_t, size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i) {
+              const size_t v = live[i];
+              if (!hasLiveNeighbor(g.offsets, g.targets, v) ||
+                  !hasLiveNeighbor(g.inOffsets, g.inTargets, v)) {
+                comp[v].store(v, relaxed);
+                trimmed.store(true, relaxed);
+              }
+            }
+          });
+      dropLabelled();
+      if (!trimmed.load())
+        break;
+    }
+  };
+
+  trim();
+  if (live.size() > options.serialCutoff) {
+    size_t pivot = live.front();
+    for (size_t v : live)
+      if (g.degree(v) * g.inDegree(v) > g.degree(pivot) * g.inDegree(pivot))
+        pivot = v;
+    std::vector<std::atomic<uint8_t>> forward(n);
+    for (size_t v = 0; v < n; ++v)
+      forward[v].store(0, relaxed);
+    forward[pivot].store(1, relaxed);
+    detail::parallelReach(g.offsets, g.targets, {pivot}, workers,
+                          [&](size_t, size_t w) {
+                            return unlabelled(w) &&
+                                   forward[w].exchange(1, relaxed) == 0;
+                          });
+    comp[pivot].store(pivot, relaxed);
+    detail::parallelReach(g.inOffsets, g.inTargets, {pivot}, workers,
+                          [&](size_t, size_t w) {
+                            size_t none = NO_COMPONENT;
+                            return forward[w].load(relaxed) &&
+                                   comp[w].compare_exchange_strong(
+                                       none, pivot, relaxed);
+                          });
+    dropLabelled();
+    trim();
+  }
+
+  std::vector<std::atomic<size_t>> color(n);
+  std::vector<std::atomic<uint8_t>> active(n);
+  while (live.size() > options.serialCutoff) {
+    for (size_t v : live) {
+      color[v].store(v, relaxed);
+      active[v].store(1, relaxed);
+    }
+    // Propagate the largest color forward until nothing changes.
+    for (bool changed = true; changed;) {
+      std::atomic<bool> updated{false};
+      PeakStore::parallelForDynamic(
+          live.size(), workers, SCC_FRONTIER_CHUNK,
+          [&](size_t, size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i) {
+              const size_t u = live[i];
+              if (!active[u].exchange(0, relaxed))
+                continue;
+              const size_t c = color[u].load(relaxed);
+              for (size_t e = g.offsets[u]; e < g.offsets[u + 1]; ++e) {
+                const size_t w = g.targets[e];
+                if (unlabelled(w) && detail::atomicMax(color[w], c)) {
+                  active[w].store(1, relaxed);
+                  updated.store(true, relaxed);
+                }
+              }
+            }
+          });
+      changed = updated.load();
+    }
+
+    std::vector<size_t> roots;
+    for (size_t v : live)
+      if (color[v].load(relaxed) == v) {
+        comp[v].store(v, relaxed);
+        roots.push_back(v);
+      }
+    detail::parallelReach(g.inOffsets, g.inTargets, std::move(roots),
+                          workers, [&](size_t u, size_t w) {
+                            const size_t c = color[u].load(relaxed);
+                            size_t none = NO_COMPONENT;
+                            return color[w].load(relaxed) == c &&
+                                   comp[w].compare_exchange_strong(none, c,
+                                                                   relaxed);
+                          });
+    dropLabelled();
+  }
+
+  std::vector<size_t> labels(n);
+  for (size_t v = 0; v < n; ++v)
+    labels[v] = comp[v].load(relaxed);
+  if (!live.empty())
+    detail::tarjan(g, labels);
+  return detail::finishStrongComponents(g, labels);
+}
+
+} // namespace Algorithms
+} // namespace CinderPeak
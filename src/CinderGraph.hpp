@@ -1,19 +1,23 @@
 #pragma once
 #include "Algorithms/CinderPeakAlgorithms.hpp"
 #include "Concepts.hpp"
+#include "FrozenGraph.hpp"
+#include "GraphSnapshot.hpp"
+#include "Operations/EdgeListImport.hpp"
+#include "Operations/WriteBatch.hpp"
 #include "PeakStore.hpp"
 #include "StorageEngine/DebugUtils.hpp"
 #include "StorageEngine/GraphStatistics.hpp"
+#include "StorageEngine/NeighborCache.hpp"
 #include "StorageEngine/Utils.hpp"
+#include "StorageEngine/WriteAheadLog.hpp"
+#include "StoragePolicy.hpp"
 #include <iostream>
 #include <optional>
 #include <tuple>
 #include <utility>
 
 namespace CinderPeak {
-namespace PeakStore {
-template <typename VertexType, typename EdgeType> class PeakStore;
-}
 
 /**
  * @brief Primary graph container for the CinderPeak graph library.
@@ -36,13 +40,17 @@ template <typename VertexType, typename EdgeType> class PeakStore;
  *
  * @note Primitive and custom user-defined types are supported.
  */
-template <typename VertexType, typename EdgeType> class CinderGraph;
-template <typename VertexType, typename EdgeType> class CinderGraphRowProxy {
-  CinderGraph<VertexType, EdgeType> &graph;
+template <typename VertexType, typename EdgeType, typename StoragePolicy>
+class CinderGraph;
+template <typename VertexType, typename EdgeType,
+          typename StoragePolicy = DynamicStorage>
+class CinderGraphRowProxy {
+  CinderGraph<VertexType, EdgeType, StoragePolicy> &graph;
   VertexType src;
 
 public:
-  CinderGraphRowProxy(CinderGraph<VertexType, EdgeType> &g, const VertexType &s)
+  CinderGraphRowProxy(CinderGraph<VertexType, EdgeType, StoragePolicy> &g,
+                      const VertexType &s)
       : graph(g), src(s) {}
 
   EdgeType operator[](const VertexType &dest) const {
@@ -62,11 +70,11 @@ public:
   }
 
   struct EdgeAssignProxy {
-    CinderGraph<VertexType, EdgeType> &graph;
+    CinderGraph<VertexType, EdgeType, StoragePolicy> &graph;
     VertexType src, dest;
 
-    EdgeAssignProxy(CinderGraph<VertexType, EdgeType> &g, const VertexType &s,
-                    const VertexType &d)
+    EdgeAssignProxy(CinderGraph<VertexType, EdgeType, StoragePolicy> &g,
+                    const VertexType &s, const VertexType &d)
         : graph(g), src(s), dest(d) {}
 
     EdgeAssignProxy &operator=(const EdgeType &weight) {
@@ -96,10 +104,14 @@ public:
  *
  * @tparam VertexType Vertex representation type.
  * @tparam EdgeType Edge or edge-weight representation type.
+ * @tparam StoragePolicy DynamicStorage (default, runtime-switchable backend)
+ * or AdjacencyStorage (statically bound backend, see StoragePolicy.hpp).
  */
-template <typename VertexType, typename EdgeType> class CinderGraph {
-  std::unique_ptr<CinderPeak::PeakStore::PeakStore<VertexType, EdgeType>>
-      peak_store;
+template <typename VertexType, typename EdgeType, typename StoragePolicy>
+class CinderGraph {
+  using Store = CinderPeak::PeakStore::PeakStore<VertexType, EdgeType,
+                                                 StoragePolicy>;
+  std::unique_ptr<Store> peak_store;
 
   using EdgeKey = std::pair<VertexType, VertexType>;
   using WeightedEdgeKey = std::tuple<VertexType, VertexType, EdgeType>;
@@ -116,6 +128,10 @@ template <typename VertexType, typename EdgeType> class CinderGraph {
   using RemoveEdgeResult = std::pair<std::optional<EdgeType>, bool>;
   using NeighborListResult = std::vector<std::pair<VertexType, EdgeType>>;
 
+  // Key type of read-only lookups: std::string_view for string vertices,
+  // const VertexType& otherwise.
+  using LookupKey = VertexLookupKey<VertexType>;
+
 public:
   /**
    * @brief Constructs a graph instance with the provided configuration.
@@ -136,8 +152,150 @@ public:
         Traits::isGraphWeighted<EdgeType>(),
         !Traits::isGraphWeighted<EdgeType>());
 
-    peak_store = std::make_unique<PeakStore::PeakStore<VertexType, EdgeType>>(
-        metadata, options);
+    peak_store = std::make_unique<Store>(metadata, options);
+  }
+
+  // Async calls hold a pointer to the graph, so moves and destruction first
+  // wait for the ones still queued.
+  CinderGraph(CinderGraph &&other) noexcept {
+    other.waitAsync();
+    peak_store = std::move(other.peak_store);
+  }
+
+  CinderGraph &operator=(CinderGraph &&other) noexcept {
+    if (this != &other) {
+      waitAsync();
+      other.waitAsync();
+      peak_store = std::move(other.peak_store);
+    }
+    return *this;
+  }
+
+  ~CinderGraph() { waitAsync(); }
+
+  /**
+   * @brief Builds a graph from an edge list in one bulk pass.
+   *
+   * Vertices are taken from the edge endpoints and interned in parallel.
+   * Edges are deduplicated with a parallel sort and written straight into
+   * storage, and the metadata counts are set once at the end. Self loops
+   * and duplicates are dropped under the same rules addEdge applies.
+   *
+   * @param edges Random-access range of std::pair<V, V> or
+   * std::tuple<V, V, E>.
+   * @param options Graph configuration options.
+   *
+   * @return The populated graph.
+   *
+   * @complexity
+   * O(E log E / P) for P hardware threads.
+   */
+  template <typename EdgeContainer>
+  static CinderGraph
+  fromEdges(const EdgeContainer &edges,
+            const GraphCreationOptions &options =
+                GraphCreationOptions::getDefaultCreateOptions()) {
+    CinderGraph graph(options);
+    graph.peak_store->log(LogLevel::INFO, "API: Entering fromEdges");
+    auto resp = graph.peak_store->bulkLoad(edges);
+    if (!resp.isOK()) {
+      graph.peak_store->log(LogLevel::WARNING, "API: Error in fromEdges");
+      Exceptions::handle_exception_map(resp);
+    }
+    return graph;
+  }
+
+  /**
+   * @brief Builds a graph from an edge-list or Matrix Market file.
+   *
+   * The file is memory-mapped and parsed in parallel chunks, then loaded
+   * through the same bulk path as fromEdges(). Edge lists hold one
+   * "src dest [weight]" line per edge, separated by spaces, tabs or commas;
+   * weighted graphs require the weight column. '#' and '%' start comment
+   * lines. Vertex ids must be integers.
+   *
+   * @param path File to read.
+   * @param options Graph configuration options.
+   * @param import Format (detected by default) and parser thread count.
+   *
+   * @return The populated graph.
+   *
+   * @throws Exception propagated through the configured exception handler
+   * when the file cannot be read or a line cannot be parsed.
+   */
+  static CinderGraph
+  fromFile(const std::string &path,
+           const GraphCreationOptions &options =
+               GraphCreationOptions::getDefaultCreateOptions(),
+           const EdgeListImportOptions &import = EdgeListImportOptions()) {
+    CinderGraph graph(options);
+    graph.peak_store->log(LogLevel::INFO, "API: Entering fromFile");
+    auto resp = graph.peak_store->importFile(path, import);
+    if (!resp.isOK()) {
+      graph.peak_store->log(LogLevel::WARNING, "API: Error in fromFile");
+      Exceptions::handle_exception_map(resp);
+    }
+    return graph;
+  }
+
+  /**
+   * @brief Builds a graph from an already interned and deduplicated set.
+   *
+   * Loads the set as-is (see BulkEdgeSet); used by FrozenGraph::thaw().
+   *
+   * @param set Vertices and id-based edges to load.
+   * @param options Graph configuration options.
+   *
+   * @return The populated graph.
+   */
+  static CinderGraph
+  fromEdgeSet(const BulkEdgeSet<VertexType, EdgeType> &set,
+              const GraphCreationOptions &options =
+                  GraphCreationOptions::getDefaultCreateOptions()) {
+    CinderGraph graph(options);
+    auto resp = graph.peak_store->bulkLoadSet(set);
+    if (!resp.isOK()) {
+      graph.peak_store->log(LogLevel::WARNING, "API: Error in fromEdgeSet");
+      Exceptions::handle_exception_map(resp);
+    }
+    return graph;
+  }
+
+  /**
+   * @brief Takes an immutable CSR snapshot of the graph.
+   *
+   * The snapshot is taken under one storage lock. Later changes to this
+   * graph do not affect it. FrozenGraph reads take no locks and are safe
+   * from any thread.
+   *
+   * @return FrozenGraph holding the current vertices and edges.
+   *
+   * @complexity
+   * O(V + E log E)
+   */
+  FrozenGraph<VertexType, EdgeType> freeze() const {
+    peak_store->log(LogLevel::INFO, "API: Entering freeze");
+    return FrozenGraph<VertexType, EdgeType>(peak_store->exportEdgeSet(),
+                                             peak_store->getCreateOptions());
+  }
+
+  /**
+   * @brief Opens a consistent read view of the graph as it is now.
+   *
+   * Unlike freeze(), nothing is copied up front: writers save the old
+   * version of whatever they change while the snapshot is alive, and those
+   * versions are freed with its last copy. Writes to this graph can
+   * continue while the snapshot is scanned.
+   *
+   * @return GraphSnapshot reading the current vertices and edges.
+   *
+   * @complexity
+   * O(V) to open; each later write pays O(row) once per snapshot for the
+   * first change to a row.
+   */
+  GraphSnapshot<VertexType, EdgeType> snapshot() const {
+    peak_store->log(LogLevel::INFO, "API: Entering snapshot");
+    return peak_store->snapshot();
   }
 
   /**
@@ -192,6 +350,34 @@ public:
     return true;
   }
 
+  /**
+   * @brief Applies a batch of mutations with a single commit.
+   *
+   * Operations run in insertion order under one storage lock, follow the
+   * same rules as the individual calls, and emit one coalesced event and
+   * metadata update. A failing operation is skipped while the rest still
+   * apply.
+   *
+   * @param batch Operations to apply.
+   *
+   * @return BatchResult with one applied bit per operation and the status
+   * of the first failure.
+   *
+   * @note When exceptions are enabled, the first failure is thrown after
+   * the batch has been applied.
+   */
+  BatchResult apply(const WriteBatch<VertexType, EdgeType> &batch) {
+    peak_store->log(LogLevel::INFO, "API: Entering apply");
+    BatchResult result = peak_store->apply(batch);
+    if (!result.allApplied()) {
+      peak_store->log(LogLevel::WARNING, "API: Error in apply");
+      Exceptions::handle_exception_map(result.firstError);
+      return result;
+    }
+    peak_store->log(LogLevel::INFO, "API: apply completed successfully");
+    return result;
+  }
+
   /**
    * @brief Removes an edge between two vertices.
    *
@@ -261,7 +447,8 @@ public:
   /**
    * @brief Checks whether a vertex exists in the graph.
    *
-   * @param v Vertex to query.
+   * @param v Vertex to query. For string vertices any std::string,
+   * std::string_view or C string is accepted without allocating.
    *
    * @return true if the vertex exists.
    * @return false otherwise.
@@ -269,7 +456,7 @@ public:
    * @complexity
    * Average: O(1)
    */
-  bool hasVertex(const VertexType &v) { return peak_store->hasVertex(v); }
+  bool hasVertex(LookupKey v) { return peak_store->hasVertex(v); }
   template <typename E = EdgeType>
 
   /**
@@ -384,9 +571,10 @@ public:
    *
    * @complexity
    * Depends on storage backend implementation.
+   *
+   * @note String vertices may be passed as std::string_view or C strings.
    */
-  std::optional<EdgeType> getEdge(const VertexType &src,
-                                  const VertexType &dest) {
+  std::optional<EdgeType> getEdge(LookupKey src, LookupKey dest) {
     auto [data, status] = peak_store->getEdge(src, dest);
     if (!status.isOK()) {
       Exceptions::handle_exception_map(status);
@@ -411,10 +599,13 @@ public:
    * O(deg(v)) — proportional to the out-degree of the vertex.
    *
    * @throws Exception propagated through the configured exception handler.
+   *
+   * @note String vertices may be passed as std::string_view or C strings.
    */
-  NeighborListResult getNeighbors(const VertexType &v) const {
-    peak_store->log(LogLevel::INFO,
-                    "API: Entering getNeighbors for " + vertexStr(v));
+  NeighborListResult getNeighbors(LookupKey v) const {
+    if (peak_store->isLoggingEnabled())
+      peak_store->log(LogLevel::INFO,
+                      "API: Entering getNeighbors for " + vertexStr(v));
     auto [neighbors, status] = peak_store->getNeighbors(v);
     if (!status.isOK()) {
       peak_store->log(LogLevel::WARNING, "API: Error in getNeighbors");
@@ -425,6 +616,26 @@ public:
     return neighbors;
   }
 
+  /**
+   * @brief Caches materialised getNeighbors() results.
+   *
+   * Up to capacity rows are kept with CLOCK replacement. Each mutation
+   * drops exactly the rows it changes (both endpoints for undirected
+   * edges, every row naming a removed vertex), so cached reads always
+   * match storage. Calling again resizes and empties the cache; 0 turns it
+   * off. Call before sharing the graph between threads.
+   *
+   * @param capacity Maximum number of cached vertices.
+   */
+  void enableNeighborCache(size_t capacity) {
+    peak_store->enableNeighborCache(capacity);
+  }
+
+  // Hit and miss counts, cached rows and capacity of the neighbor cache.
+  NeighborCacheStats neighborCacheStats() const {
+    return peak_store->neighborCacheStats();
+  }
+
   /**
    * @brief Performs Breadth-First Search traversal.
    *
@@ -441,6 +652,154 @@ public:
     return peak_store->bfs(src);
   }
 
+  /**
+   * @brief Performs BFS with frontier expansion spread across threads.
+   *
+   * Returns the same order, depths and parents as a serial queue-based
+   * BFS. Levels too small to be worth splitting run on the calling thread.
+   *
+   * @param src Starting vertex for traversal.
+   * @param options Worker count and per-worker edge threshold.
+   *
+   * @complexity
+   * O((V + E) / P) per level for P workers, plus one thread start per
+   * parallel level; both expansion passes share those threads.
+   */
+  Algorithms::BFSResult<VertexType>
+  parallelBFS(const VertexType &src,
+              const Algorithms::ParallelBFSOptions &options = {}) {
+    return peak_store->parallelBFS(src, options);
+  }
+
+  /**
+   * @brief Computes shortest paths from src with Dijkstra's algorithm.
+   *
+   * Requires a numeric EdgeType and non-negative weights; a negative
+   * weight yields an InvalidArgument status.
+   *
+   * @param src Source vertex.
+   *
+   * @return Distances and predecessors indexed by CSR vertex index, with
+   *         distanceTo() / pathTo() lookups by vertex.
+   *
+   * @complexity
+   * O((V + E) log V)
+   */
+  template <typename E = EdgeType>
+  Algorithms::ShortestPathResult<VertexType, E>
+  shortestPaths(const VertexType &src) {
+    STATIC_ASSERT_NUMERIC_EDGE(E);
+    return peak_store->shortestPaths(src, std::nullopt);
+  }
+
+  /**
+   * @brief Computes shortest paths from src with parallel delta-stepping.
+   *
+   * Same distances as shortestPaths(); among equally short paths the
+   * predecessors may differ.
+   *
+   * @param src Source vertex.
+   * @param options Bucket width (0 picks one from the weights), worker
+   *        count and minimum work per worker; small graphs run serially.
+   */
+  template <typename E = EdgeType>
+  Algorithms::ShortestPathResult<VertexType, E> parallelShortestPaths(
+      const VertexType &src,
+      const Algorithms::DeltaSteppingOptions &options = {}) {
+    STATIC_ASSERT_NUMERIC_EDGE(E);
+    return peak_store->shortestPaths(src, options);
+  }
+
+  /**
+   * @brief Computes PageRank over the whole graph.
+   *
+   * Pull-based and multi-threaded; vertices without out-edges spread
+   * their rank evenly. Edge weights are ignored.
+   *
+   * @param damping Probability of following an edge, in [0, 1).
+   * @param tolerance Stops once the L1 change of the ranks drops below it.
+   * @param maxIterations Upper bound on iterations.
+   *
+   * @return Ranks indexed by CSR vertex index (rankOf(v) by vertex),
+   *         iteration count, final error and per-iteration wall times.
+   *
+   * @complexity
+   * O(E / P) per iteration for P hardware threads.
+   */
+  Algorithms::PageRankResult<VertexType>
+  pageRank(double damping = 0.85, double tolerance = 1e-4,
+           size_t maxIterations = 100) {
+    return peak_store->pageRank(damping, tolerance, maxIterations);
+  }
+
+  /**
+   * @brief Labels the connected components of the graph.
+   *
+   * Multi-threaded (Afforest). On directed graphs edge direction is
+   * ignored, which gives the weakly connected components.
+   *
+   * @return A component id per CSR vertex index (componentOf(v) by
+   *         vertex, ids numbered from 0) and the size of each component.
+   *
+   * @complexity
+   * O(V + E) work, spread over the hardware threads.
+   */
+  Algorithms::ComponentsResult<VertexType> connectedComponents() {
+    return peak_store->connectedComponents();
+  }
+
+  /**
+   * @brief Labels the strongly connected components of the graph.
+   *
+   * Iterative Tarjan, so deep graphs cannot overflow the stack. On
+   * undirected graphs these are the connected components.
+   *
+   * @return A component id per CSR vertex index (componentOf(v) by
+   *         vertex), component sizes and the condensation DAG
+   *         (successors(c)).
+   *
+   * @complexity
+   * O(V + E), plus O(E log E) for the condensation.
+   */
+  Algorithms::StrongComponentsResult<VertexType>
+  stronglyConnectedComponents() {
+    return peak_store->stronglyConnectedComponents(std::nullopt);
+  }
+
+  /**
+   * @brief Multi-threaded stronglyConnectedComponents().
+   *
+   * Trims trivial components, peels the giant one with a forward-backward
+   * search from a high-degree pivot, then labels the rest by coloring.
+   * Same result as stronglyConnectedComponents().
+   *
+   * @param options Worker count and the size below which Tarjan finishes
+   *        serially.
+   */
+  Algorithms::StrongComponentsResult<VertexType>
+  parallelStronglyConnectedComponents(
+      const Algorithms::SCCOptions &options = {}) {
+    return peak_store->stronglyConnectedComponents(options);
+  }
+
+  /**
+   * @brief Counts triangles and local clustering coefficients.
+   *
+   * Multi-threaded. Edge direction, weights, self loops and parallel edges
+   * are ignored: a triangle is three vertices pairwise joined by an edge
+   * in either direction.
+   *
+   * @return Triangles through each CSR vertex index (trianglesOf(v) by
+   *         vertex), the local clustering coefficient of each vertex
+   *         (clusteringOf(v)) and the total triangle count.
+   *
+   * @complexity
+   * O(E^1.5) worst case, spread over the hardware threads.
+   */
+  Algorithms::TriangleCountResult<VertexType> countTriangles() {
+    return peak_store->countTriangles();
+  }
+
   template <typename V = VertexType, typename E = EdgeType>
 
   /**
@@ -480,13 +839,152 @@ public:
   }
   void unsetFileLogging() { peak_store->unsetFileLogging(); }
 
-  CinderGraphRowProxy<VertexType, EdgeType> operator[](const VertexType &v) {
-    return CinderGraphRowProxy<VertexType, EdgeType>(*this, v);
+  /**
+   * @brief Makes the graph durable through a write-ahead log file.
+   *
+   * Records already in the file are replayed into the graph first; a torn
+   * record left by a crash is dropped. From then on every successful
+   * mutation is appended in a compact binary form. options.policy decides
+   * when records reach disk (per operation with group commit, every N
+   * operations, or every N milliseconds). Call before sharing the graph
+   * between threads.
+   *
+   * @param path Log file, created if missing.
+   * @param options Sync policy and the frame size large batches are split
+   * at.
+   *
+   * @return Number of records replayed.
+   *
+   * @throws Exception propagated through the configured exception handler.
+   */
+  size_t enableWriteAheadLog(const std::string &path,
+                             const WalOptions &options = WalOptions()) {
+    peak_store->log(LogLevel::INFO, "API: Entering enableWriteAheadLog");
+    auto [replayed, resp] = peak_store->enableWriteAheadLog(path, options);
+    if (!resp.isOK()) {
+      peak_store->log(LogLevel::WARNING, "API: Error in enableWriteAheadLog");
+      Exceptions::handle_exception_map(resp);
+    }
+    return replayed;
+  }
+
+  // Forces all logged mutations to disk; false if that failed or no log is
+  // attached.
+  bool syncWriteAheadLog() {
+    auto resp = peak_store->syncWriteAheadLog();
+    if (!resp.isOK()) {
+      Exceptions::handle_exception_map(resp);
+      return false;
+    }
+    return true;
+  }
+
+  // Syncs and detaches the log. Later mutations are not logged.
+  void disableWriteAheadLog() {
+    auto resp = peak_store->disableWriteAheadLog();
+    if (!resp.isOK())
+      Exceptions::handle_exception_map(resp);
+  }
+
+  /**
+   * @brief Runs fn(*this) on the graph's worker pool.
+   *
+   * The pool belongs to the graph's GraphRuntime and starts its threads on
+   * the first async call. Calls are queued in submission order and run
+   * concurrently, under the same storage locks as their synchronous
+   * counterparts, so callers can pipeline work instead of blocking on it.
+   * The result, or the exception thrown when exceptions are enabled,
+   * arrives through the future.
+   *
+   * @param fn Callable taking CinderGraph&. It is copied or moved into the
+   * task, so capture arguments by value.
+   *
+   * @return std::future of fn's result.
+   *
+   * @note Moving or destroying the graph waits for queued calls. Do not
+   * call waitAsync() or block on another async call from inside fn.
+   */
+  template <typename Fn> auto async(Fn &&fn) {
+    return peak_store->runAsync(
+        [this, fn = std::forward<Fn>(fn)]() mutable { return fn(*this); });
+  }
+
+  // Async forms of the calls above. Arguments are copied into the task.
+  auto addVertexAsync(const VertexType &v) {
+    return async([v](CinderGraph &g) { return g.addVertex(v); });
+  }
+
+  auto removeVertexAsync(const VertexType &v) {
+    return async([v](CinderGraph &g) { return g.removeVertex(v); });
+  }
+
+  template <typename E = EdgeType,
+            typename = std::enable_if_t<Traits::is_unweighted_v<E>>>
+  auto addEdgeAsync(const VertexType &src, const VertexType &dest) {
+    return async(
+        [src, dest](CinderGraph &g) { return g.addEdge(src, dest); });
+  }
+
+  template <typename E = EdgeType,
+            typename = std::enable_if_t<!Traits::is_unweighted_v<E>>>
+  auto addEdgeAsync(const VertexType &src, const VertexType &dest,
+                    const EdgeType &weight) {
+    return async([src, dest, weight](CinderGraph &g) {
+      return g.addEdge(src, dest, weight);
+    });
+  }
+
+  template <typename E = EdgeType,
+            typename = std::enable_if_t<Traits::is_weighted_v<E>>>
+  auto updateEdgeAsync(const VertexType &src, const VertexType &dest,
+                       const EdgeType &newWeight) {
+    return async([src, dest, newWeight](CinderGraph &g) {
+      return g.updateEdge(src, dest, newWeight);
+    });
+  }
+
+  auto removeEdgeAsync(const VertexType &src, const VertexType &dest) {
+    return async(
+        [src, dest](CinderGraph &g) { return g.removeEdge(src, dest); });
+  }
+
+  auto applyAsync(WriteBatch<VertexType, EdgeType> batch) {
+    return async([batch = std::move(batch)](CinderGraph &g) {
+      return g.apply(batch);
+    });
   }
-  const CinderGraphRowProxy<VertexType, EdgeType>
-  operator[](const VertexType &v) const {
-    return CinderGraphRowProxy<VertexType, EdgeType>(
-        const_cast<CinderGraph<VertexType, EdgeType> &>(*this), v);
+
+  auto getEdgeAsync(const VertexType &src, const VertexType &dest) {
+    return async(
+        [src, dest](CinderGraph &g) { return g.getEdge(src, dest); });
+  }
+
+  auto getNeighborsAsync(const VertexType &v) {
+    return async([v](CinderGraph &g) { return g.getNeighbors(v); });
+  }
+
+  auto bfsAsync(const VertexType &src) {
+    return async([src](CinderGraph &g) { return g.bfs(src); });
+  }
+
+  // Blocks until every queued async call on this graph has finished.
+  void waitAsync() const {
+    if (peak_store)
+      peak_store->waitAsync();
+  }
+
+  // Size of the async worker pool; 0 picks one per hardware thread. Queued
+  // calls finish before the pool is resized.
+  void setAsyncWorkers(size_t threads) {
+    peak_store->setAsyncWorkers(threads);
+  }
+  size_t asyncWorkers() const { return peak_store->asyncWorkers(); }
+
+  using RowProxy = CinderGraphRowProxy<VertexType, EdgeType, StoragePolicy>;
+
+  RowProxy operator[](const VertexType &v) { return RowProxy(*this, v); }
+  const RowProxy operator[](const VertexType &v) const {
+    return RowProxy(const_cast<CinderGraph &>(*this), v);
   }
 
   // Set graph name - user-facing API
@@ -5,11 +5,4 @@
 #include "PeakStore.hpp"
 #include "StorageEngine/DebugUtils.hpp"
 #include "StorageEngine/Utils.hpp"
-namespace CinderPeak {
-namespace PeakStore {
-template <typename VertexType, typename EdgeType> class PeakStore;
-}
-
-template <typename VertexType, typename EdgeType> class CinderGraph;
-
-} // namespace CinderPeak
+#include "StoragePolicy.hpp"
@@ -11,13 +11,94 @@ void registerMetadataListeners(PeakStore::GraphContext<V, E> &ctx) {
   ctx.events.edgeAdded.subscribe(
 
       [metadata](const auto &event) {
-        metadata->updateEdgeCount(PeakStore::UpdateOp::Add);
+        // Undirected edges are counted once per stored direction.
+        metadata->updateEdgeCount(PeakStore::UpdateOp::Add,
+                                  event.undirected ? 2 : 1);
       });
 
   ctx.events.edgeRemoved.subscribe(
 
       [metadata](const auto &event) {
-        metadata->updateEdgeCount(PeakStore::UpdateOp::Remove);
+        metadata->updateEdgeCount(PeakStore::UpdateOp::Remove,
+                                  event.undirected ? 2 : 1);
+      });
+
+  ctx.events.batchApplied.subscribe(
+
+      [metadata](const auto &event) {
+        const BatchResult &result = event.result;
+        metadata->applyCountDelta(result.verticesAdded, result.verticesRemoved,
+                                  result.edgesAdded, result.edgesRemoved);
+      });
+}
+
+// Marks the hybrid CSR stale after any change to vertices or edges.
+template <typename V, typename E>
+void registerHybridSyncListeners(PeakStore::GraphContext<V, E> &ctx) {
+
+  auto *stale = &ctx.hybrid_stale;
+  auto mark = [stale](const auto &) {
+    stale->store(true, std::memory_order_release);
+  };
+  ctx.events.edgeAdded.subscribe(mark);
+  ctx.events.edgeRemoved.subscribe(mark);
+  ctx.events.edgeUpdated.subscribe(mark);
+  ctx.events.batchApplied.subscribe(mark);
+  ctx.events.vertexAdded.subscribe(mark);
+  ctx.events.vertexRemoved.subscribe(mark);
+  ctx.events.cleared.subscribe(mark);
+}
+
+// Drops exactly the cached rows each mutation changes. Undirected edges
+// live in both endpoints' rows.
+template <typename V, typename E>
+void registerNeighborCacheListeners(
+    PeakStore::GraphContext<V, E> &ctx,
+    const std::shared_ptr<PeakStore::NeighborCache<V, E>> &cache,
+    bool undirected) {
+
+  auto invalidateEdge = [cache](const V &src, const V &dest, bool pair) {
+    cache->invalidate(src);
+    if (pair)
+      cache->invalidate(dest);
+  };
+
+  ctx.events.edgeAdded.subscribe([invalidateEdge](const auto &event) {
+    invalidateEdge(event.src, event.dest, event.undirected);
+  });
+
+  ctx.events.edgeRemoved.subscribe([invalidateEdge](const auto &event) {
+    invalidateEdge(event.src, event.dest, event.undirected);
+  });
+
+  ctx.events.edgeUpdated.subscribe([invalidateEdge](const auto &event) {
+    invalidateEdge(event.src, event.dest, event.undirected);
+  });
+
+  ctx.events.vertexRemoved.subscribe([cache](const auto &event) {
+    cache->invalidateReferencing(event.vertex);
+  });
+
+  ctx.events.cleared.subscribe([cache](const auto &) { cache->clear(); });
+
+  ctx.events.batchApplied.subscribe(
+
+      [cache, invalidateEdge, undirected](const auto &event) {
+        const auto &ops = event.batch.ops();
+        for (size_t i = 0; i < ops.size(); ++i) {
+          if (!event.result.applied[i])
+            continue;
+          switch (ops[i].kind) {
+          case BatchOpKind::AddVertex:
+            break;
+          case BatchOpKind::RemoveVertex:
+            cache->invalidateReferencing(ops[i].src);
+            break;
+          default:
+            invalidateEdge(ops[i].src, ops[i].dest, undirected);
+            break;
+          }
+        }
       });
 }
 
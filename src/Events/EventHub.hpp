@@ -11,9 +11,15 @@ template <typename V, typename E> struct EventHub {
 
   EventDispatcher<EdgeRemovedEvent<V, E>> edgeRemoved;
 
+  EventDispatcher<EdgeUpdatedEvent<V, E>> edgeUpdated;
+
+  EventDispatcher<BatchAppliedEvent<V, E>> batchApplied;
+
   EventDispatcher<VertexAddedEvent<V>> vertexAdded;
 
   EventDispatcher<VertexRemovedEvent<V>> vertexRemoved;
+
+  EventDispatcher<GraphClearedEvent> cleared;
 };
 
 } // namespace CinderPeak
\ No newline at end of file
@@ -1,4 +1,5 @@
 #pragma once
+#include "Operations/WriteBatch.hpp"
 
 namespace CinderPeak {
 
@@ -7,12 +8,32 @@ template <typename V, typename E> struct EdgeAddedEvent {
   const V &src;
   const V &dest;
   const E &weight;
+  // True when dest->src was written together with src->dest.
+  bool undirected = false;
 };
 
 template <typename V, typename E> struct EdgeRemovedEvent {
 
   const V &src;
   const V &dest;
+  // True when dest->src was removed together with src->dest.
+  bool undirected = false;
+};
+
+template <typename V, typename E> struct EdgeUpdatedEvent {
+
+  const V &src;
+  const V &dest;
+  const E &weight;
+  // True when dest->src was updated together with src->dest.
+  bool undirected = false;
+};
+
+// Emitted once per applied WriteBatch instead of one event per operation.
+template <typename V, typename E> struct BatchAppliedEvent {
+
+  const WriteBatch<V, E> &batch;
+  const BatchResult &result;
 };
 
 template <typename V> struct VertexAddedEvent {
@@ -25,4 +46,11 @@ template <typename V> struct VertexRemovedEvent {
   const V &vertex;
 };
 
+// Emitted when storage is rewritten wholesale (clears and bulk loads).
+struct GraphClearedEvent {
+
+  // False when only the edges were cleared.
+  bool vertices = true;
+};
+
 } // namespace CinderPeak
\ No newline at end of file
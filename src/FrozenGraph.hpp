@@ -0,0 +1,202 @@
+#pragma once
+#include "Operations/BulkBuild.hpp"
+#include "StorageEngine/ParallelUtils.hpp"
+#include "StorageEngine/Utils.hpp"
+#include "StorageEngine/VertexIndex.hpp"
+#include "StoragePolicy.hpp"
+#include <algorithm>
+#include <memory_resource>
+#include <optional>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace CinderPeak {
+
+/**
+ * @brief Immutable, read-only snapshot of a CinderGraph in compact CSR form.
+ *
+ * Produced by CinderGraph::freeze(). Edges live in three flat arrays (row
+ * offsets, destination indices, weights) with each row sorted by
+ * destination. There is no COO buffer, no lazy build and no mutex. Every
+ * method is const and only reads arrays and the vertex index, so any
+ * number of threads may query a FrozenGraph concurrently.
+ *
+ * Vertices are addressed by dense indices 0..numVertices()-1, in the order
+ * the source graph assigned them. Missing vertices or edges yield an empty
+ * result rather than an error; there is no logger or exception policy.
+ *
+ * thaw() copies the snapshot back into a mutable CinderGraph.
+ *
+ * @tparam VertexType Vertex representation type.
+ * @tparam EdgeType Edge or edge-weight representation type.
+ */
+template <typename VertexType, typename EdgeType> class FrozenGraph {
+public:
+  using LookupKey = VertexLookupKey<VertexType>;
+  using NeighborListResult = std::vector<std::pair<VertexType, EdgeType>>;
+
+private:
+  using Index = PeakStore::VertexIndex<VertexType, size_t>;
+  using VertexKey = typename Index::key_type;
+
+  Index _index;
+  std::vector<VertexKey> _vertex_keys;
+  std::vector<size_t> _row_offsets{0};
+  std::vector<size_t> _columns;
+  std::vector<EdgeType> _weights;
+  GraphCreationOptions _options;
+
+  VertexType vertexValue(size_t idx) const {
+    return VertexType(_index.value(_vertex_keys[idx]));
+  }
+
+public:
+  /**
+   * @brief Builds the CSR arrays from an edge set.
+   *
+   * An undirected set (one entry per edge) is expanded to both directions,
+   * so the frozen graph always lists every stored direction.
+   */
+  FrozenGraph(BulkEdgeSet<VertexType, EdgeType> set,
+              const GraphCreationOptions &options)
+      : _options(options) {
+    // The source's memory resource may not outlive the snapshot.
+    _options.setMemoryResource(nullptr);
+    const size_t n = set.vertices.size();
+    _vertex_keys.reserve(n);
+    _index.reserve(n);
+    for (size_t i = 0; i < n; ++i)
+      _vertex_keys.push_back(_index.insert(set.vertices[i], i));
+
+    if (set.undirected) {
+      const size_t count = set.edges.size();
+      set.edges.reserve(2 * count);
+      for (size_t i = 0; i < count; ++i) {
+        const auto &edge = set.edges[i];
+        set.edges.push_back({edge.dest, edge.src, edge.weight});
+      }
+    }
+    PeakStore::parallelSort(
+        set.edges,
+        [](const BulkEdge<EdgeType> &a, const BulkEdge<EdgeType> &b) {
+          return a.src != b.src ? a.src < b.src : a.dest < b.dest;
+        },
+        PeakStore::workerCount(set.edges.size()));
+
+    // Ids in the set are 1-based; rows here are 0-based.
+    _row_offsets.assign(n + 1, 0);
+    for (const auto &edge : set.edges)
+      ++_row_offsets[edge.src];
+    for (size_t i = 0; i < n; ++i)
+      _row_offsets[i + 1] += _row_offsets[i];
+    _columns.reserve(set.edges.size());
+    _weights.reserve(set.edges.size());
+    for (auto &edge : set.edges) {
+      _columns.push_back(edge.dest - 1);
+      _weights.push_back(std::move(edge.weight));
+    }
+  }
+
+  bool hasVertex(LookupKey v) const noexcept { return _index.contains(v); }
+
+  // Dense index of v, if present.
+  std::optional<size_t> vertexIndex(LookupKey v) const {
+    return _index.find(v);
+  }
+
+  VertexType vertexAt(size_t idx) const { return vertexValue(idx); }
+
+  std::optional<EdgeType> getEdge(LookupKey src, LookupKey dest) const {
+    auto s = _index.find(src);
+    auto d = _index.find(dest);
+    if (!s || !d)
+      return std::nullopt;
+    auto row = _columns.begin();
+    auto first = row + static_cast<std::ptrdiff_t>(_row_offsets[*s]);
+    auto last = row + static_cast<std::ptrdiff_t>(_row_offsets[*s + 1]);
+    auto it = std::lower_bound(first, last, *d);
+    if (it == last || *it != *d)
+      return std::nullopt;
+    return _weights[static_cast<size_t>(it - _columns.begin())];
+  }
+
+  NeighborListResult getNeighbors(LookupKey v) const {
+    NeighborListResult result;
+    auto idx = _index.find(v);
+    if (!idx)
+      return result;
+    result.reserve(degree(*idx));
+    for (size_t e = _row_offsets[*idx]; e < _row_offsets[*idx + 1]; ++e)
+      result.emplace_back(vertexValue(_columns[e]), _weights[e]);
+    return result;
+  }
+
+  size_t degree(size_t idx) const {
+    return _row_offsets[idx + 1] - _row_offsets[idx];
+  }
+
+  size_t numVertices() const noexcept { return _vertex_keys.size(); }
+
+  // Counted like CinderGraph::numEdges (once per stored direction).
+  size_t numEdges() const noexcept { return _columns.size(); }
+
+  bool isDirected() const {
+    return _options.hasOption(GraphCreationOptions::Directed);
+  }
+
+  // Raw CSR arrays: row i spans [rowOffsets()[i], rowOffsets()[i + 1]) of
+  // columns() and weights().
+  const std::vector<size_t> &rowOffsets() const noexcept {
+    return _row_offsets;
+  }
+  const std::vector<size_t> &columns() const noexcept { return _columns; }
+  const std::vector<EdgeType> &weights() const noexcept { return _weights; }
+
+  std::vector<VertexType> vertices() const {
+    std::vector<VertexType> result;
+    result.reserve(numVertices());
+    for (size_t i = 0; i < numVertices(); ++i)
+      result.push_back(vertexValue(i));
+    return result;
+  }
+
+  std::vector<std::tuple<VertexType, VertexType, EdgeType>> edges() const {
+    std::vector<std::tuple<VertexType, VertexType, EdgeType>> result;
+    result.reserve(numEdges());
+    for (size_t i = 0; i < numVertices(); ++i) {
+      for (size_t e = _row_offsets[i]; e < _row_offsets[i + 1]; ++e)
+        result.emplace_back(vertexValue(i), vertexValue(_columns[e]),
+                            _weights[e]);
+    }
+    return result;
+  }
+
+  /**
+   * @brief Copies the snapshot back into a mutable graph.
+   *
+   * The graph is created with the options of the frozen source and loaded
+   * in bulk, so no per-edge validation is repeated. The source's memory
+   * resource is not carried over, since it may be gone by now.
+   *
+   * @param resource Memory resource for the new graph; it must outlive the
+   *        graph. nullptr uses std::pmr::get_default_resource().
+   */
+  template <typename StoragePolicy = DynamicStorage>
+  CinderGraph<VertexType, EdgeType, StoragePolicy>
+  thaw(std::pmr::memory_resource *resource = nullptr) const {
+    BulkEdgeSet<VertexType, EdgeType> set;
+    set.vertices = vertices();
+    set.edges.reserve(numEdges());
+    for (size_t i = 0; i < numVertices(); ++i) {
+      for (size_t e = _row_offsets[i]; e < _row_offsets[i + 1]; ++e)
+        set.edges.push_back({i + 1, _columns[e] + 1, _weights[e]});
+    }
+    GraphCreationOptions options = _options;
+    options.setMemoryResource(resource);
+    return CinderGraph<VertexType, EdgeType, StoragePolicy>::fromEdgeSet(
+        set, options);
+  }
+};
+
+} // namespace CinderPeak
@@ -1,8 +1,11 @@
 #pragma once
 #include "PeakLogger.hpp"
+#include "StorageEngine/TaskPool.hpp"
 #include <atomic>
+#include <future>
 #include <mutex>
 #include <string>
+#include <utility>
 
 namespace CinderPeak {
 
@@ -15,6 +18,9 @@ private:
   std::string logFilePath;
   mutable std::mutex fileMutex;
 
+  // Runs the async graph API; threads start on first use.
+  mutable PeakStore::TaskPool asyncPool;
+
 public:
   GraphRuntime()
       : logToConsole(false), throwExceptions(false), fileLoggingEnabled(false),
@@ -40,6 +46,29 @@ public:
     fileLoggingEnabled.store(false, std::memory_order_relaxed);
   }
 
+  // Number of threads serving async calls; 0 picks one per hardware thread.
+  void setAsyncWorkers(size_t threads) { asyncPool.setThreads(threads); }
+  size_t asyncWorkers() const { return asyncPool.threads(); }
+
+  template <typename Fn> auto async(Fn &&fn) const {
+    return asyncPool.submit(std::forward<Fn>(fn));
+  }
+
+  // Blocks until every queued async call has finished.
+  void waitAsync() const { asyncPool.wait(); }
+
+  bool isLoggingEnabled() const {
+    return logToConsole.load(std::memory_order_relaxed) ||
+           fileLoggingEnabled.load(std::memory_order_relaxed);
+  }
+
+  // Literal messages: avoids building a std::string when logging is off.
+  void log(const LogLevel &level, const char *msg) const {
+    if (!isLoggingEnabled())
+      return;
+    log(level, std::string(msg));
+  }
+
   void log(const LogLevel &level, const std::string &msg) const {
     bool console = logToConsole.load(std::memory_order_relaxed);
     bool file = fileLoggingEnabled.load(std::memory_order_relaxed);
@@ -0,0 +1,83 @@
+#pragma once
+#include "StorageEngine/SnapshotState.hpp"
+#include "StorageEngine/Utils.hpp"
+#include "StoragePolicy.hpp"
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace CinderPeak {
+
+/**
+ * @brief Consistent read view of a CinderGraph at one point in time.
+ *
+ * Returned by CinderGraph::snapshot(). Opening one copies nothing; writers
+ * to the graph keep going and, the first time they change a row or vertex
+ * after the snapshot was opened, save its old value for the snapshot (see
+ * PeakStore::SnapshotState). Every read here therefore sees the graph
+ * exactly as it was when snapshot() returned, however many writes follow.
+ *
+ * Reads take the storage reader lock per call (per chunk for vertices()
+ * and edges()), never for the lifetime of the snapshot, so long scans and
+ * a high write rate can run side by side. Saved versions are reclaimed
+ * when the last copy of the snapshot is destroyed. Copies share state and
+ * are cheap.
+ *
+ * Missing vertices or edges yield an empty result rather than an error,
+ * as in FrozenGraph.
+ *
+ * @tparam VertexType Vertex representation type.
+ * @tparam EdgeType Edge or edge-weight representation type.
+ */
+template <typename VertexType, typename EdgeType> class GraphSnapshot {
+public:
+  using LookupKey = VertexLookupKey<VertexType>;
+  using NeighborListResult = std::vector<std::pair<VertexType, EdgeType>>;
+  using Storage = PeakStore::AdjacencyList<VertexType, EdgeType>;
+  using State = PeakStore::SnapshotState<VertexType, EdgeType>;
+
+private:
+  std::shared_ptr<const Storage> _storage;
+  std::shared_ptr<const State> _state;
+
+public:
+  GraphSnapshot(std::shared_ptr<const Storage> storage,
+                std::shared_ptr<const State> state)
+      : _storage(std::move(storage)), _state(std::move(state)) {}
+
+  // Increases with every snapshot taken of the same graph.
+  uint64_t sequence() const noexcept { return _state->sequence; }
+
+  size_t numVertices() const noexcept { return _state->num_vertices; }
+
+  // Counted like CinderGraph::numEdges (once per stored direction).
+  size_t numEdges() const noexcept { return _state->num_edges; }
+
+  bool hasVertex(LookupKey v) const {
+    return _storage->snapshotHasVertex(*_state, v);
+  }
+
+  std::optional<EdgeType> getEdge(LookupKey src, LookupKey dest) const {
+    auto [weight, status] = _storage->snapshotGetEdge(*_state, src, dest);
+    if (!status.isOK())
+      return std::nullopt;
+    return weight;
+  }
+
+  NeighborListResult getNeighbors(LookupKey v) const {
+    return _storage->snapshotGetNeighbors(*_state, v).first;
+  }
+
+  std::vector<VertexType> vertices() const {
+    return _storage->snapshotVertices(*_state);
+  }
+
+  std::vector<std::tuple<VertexType, VertexType, EdgeType>> edges() const {
+    return _storage->snapshotEdgeList(*_state);
+  }
+};
+
+} // namespace CinderPeak
@@ -0,0 +1,172 @@
+#pragma once
+#include "StorageEngine/ParallelUtils.hpp"
+#include "StorageEngine/Utils.hpp"
+#include <iterator>
+#include <tuple>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace CinderPeak {
+
+template <typename EdgeType> struct BulkEdge {
+  VertexId src;
+  VertexId dest;
+  EdgeType weight;
+};
+
+/**
+ * @brief Interned vertices and deduplicated edges ready to load into storage.
+ *
+ * vertices[i] owns VertexId i + 1. Edges are sorted by (src, dest) and hold
+ * no self loops or duplicates. For undirected graphs each edge is listed
+ * once with src < dest, and the storage writes both directions.
+ */
+template <typename VertexType, typename EdgeType> struct BulkEdgeSet {
+  std::vector<VertexType> vertices;
+  std::vector<BulkEdge<EdgeType>> edges;
+  bool undirected = false;
+
+  // Edge count as tracked by the graph metadata (2 per undirected edge).
+  size_t storedEdgeCount() const {
+    return undirected ? 2 * edges.size() : edges.size();
+  }
+};
+
+/**
+ * @brief Builds a BulkEdgeSet from a random-access range of edges.
+ *
+ * Elements are std::pair<V, V> or std::tuple<V, V, E>; pairs get a default
+ * weight, as do all edges of unweighted graphs. Duplicates follow the
+ * addEdge rules: an edge repeats another when src and dest match (and, on
+ * weighted graphs, the weight too).
+ *
+ * Endpoints are hashed into one shard per worker and each worker interns
+ * its own shard, so no locks are taken. Edges are then encoded to ids and
+ * sorted in parallel before a linear deduplication pass.
+ */
+template <typename VertexType, typename EdgeType, typename EdgeContainer>
+BulkEdgeSet<VertexType, EdgeType>
+buildEdgeSet(const EdgeContainer &input, const EdgeInsertRules &rules,
+             size_t workers = 0) {
+  using Element = typename EdgeContainer::value_type;
+  using Iterator = decltype(std::begin(input));
+  using Category = typename std::iterator_traits<Iterator>::iterator_category;
+  static_assert(std::is_base_of_v<std::random_access_iterator_tag, Category>,
+                "buildEdgeSet needs a random-access edge range");
+  using Hasher = VertexHasher<VertexType>;
+  using Shard =
+      std::unordered_map<VertexType, VertexId, Hasher, VertexEqual<VertexType>>;
+
+  const auto first = std::begin(input);
+  const size_t count = static_cast<size_t>(std::end(input) - first);
+  if (workers == 0)
+    workers = PeakStore::workerCount(count);
+  workers = std::max<size_t>(1, workers);
+
+  BulkEdgeSet<VertexType, EdgeType> result;
+  result.undirected = !rules.directed;
+
+  // 1. Route each endpoint to the shard owning its hash. outbox[w][s] holds
+  //    the endpoints worker w found for shard s, in input order.
+  std::vector<std::vector<std::vector<const VertexType *>>> outbox(
+      workers, std::vector<std::vector<const VertexType *>>(workers));
+  PeakStore::parallelFor(count, workers, [&](size_t w, size_t lo, size_t hi) {
+    Hasher hash;
+    for (size_t i = lo; i < hi; ++i) {
+      const Element &e = first[static_cast<std::ptrdiff_t>(i)];
+      const VertexType &src = std::get<0>(e);
+      const VertexType &dest = std::get<1>(e);
+      outbox[w][hash(src) % workers].push_back(&src);
+      outbox[w][hash(dest) % workers].push_back(&dest);
+    }
+  });
+
+  // 2. Intern each shard. Local ids are 0-based positions in shard_order.
+  std::vector<Shard> shards(workers);
+  std::vector<std::vector<const VertexType *>> shard_order(workers);
+  PeakStore::parallelFor(workers, workers, [&](size_t, size_t lo, size_t hi) {
+    for (size_t s = lo; s < hi; ++s) {
+      for (size_t w = 0; w < workers; ++w) {
+        for (const VertexType *v : outbox[w][s]) {
+          if (shards[s].try_emplace(*v, shard_order[s].size()).second)
+            shard_order[s].push_back(v);
+        }
+      }
+    }
+  });
+  outbox.clear();
+
+  std::vector<VertexId> base(workers + 1, 1);
+  for (size_t s = 0; s < workers; ++s)
+    base[s + 1] = base[s] + shard_order[s].size();
+  result.vertices.reserve(base[workers] - 1);
+  for (size_t s = 0; s < workers; ++s) {
+    for (const VertexType *v : shard_order[s])
+      result.vertices.push_back(*v);
+  }
+
+  // 3. Encode edges as ids. Self loops are dropped, as addEdge rejects them.
+  std::vector<std::vector<BulkEdge<EdgeType>>> encoded(workers);
+  PeakStore::parallelFor(count, workers, [&](size_t w, size_t lo, size_t hi) {
+    Hasher hash;
+    auto idOf = [&](const VertexType &v) {
+      size_t s = hash(v) % workers;
+      return base[s] + shards[s].find(v)->second;
+    };
+    auto &out = encoded[w];
+    out.reserve(hi - lo);
+    for (size_t i = lo; i < hi; ++i) {
+      const Element &e = first[static_cast<std::ptrdiff_t>(i)];
+      VertexId src = idOf(std::get<0>(e));
+      VertexId dest = idOf(std::get<1>(e));
+      if (src == dest)
+        continue;
+      if (!rules.directed && dest < src)
+        std::swap(src, dest);
+      EdgeType weight = EdgeType();
+      if constexpr (std::tuple_size_v<Element> >= 3) {
+        if (rules.weighted)
+          weight = std::get<2>(e);
+      }
+      out.push_back({src, dest, std::move(weight)});
+    }
+  });
+
+  std::vector<BulkEdge<EdgeType>> edges;
+  size_t total = 0;
+  for (const auto &part : encoded)
+    total += part.size();
+  edges.reserve(total);
+  for (auto &part : encoded) {
+    std::move(part.begin(), part.end(), std::back_inserter(edges));
+    std::vector<BulkEdge<EdgeType>>().swap(part);
+  }
+
+  // 4. Sort by (src, dest) and drop repeats.
+  PeakStore::parallelSort(
+      edges,
+      [](const BulkEdge<EdgeType> &a, const BulkEdge<EdgeType> &b) {
+        return a.src != b.src ? a.src < b.src : a.dest < b.dest;
+      },
+      workers);
+
+  result.edges.reserve(edges.size());
+  size_t run_start = 0;
+  for (auto &edge : edges) {
+    auto &kept = result.edges;
+    if (run_start < kept.size() && (kept[run_start].src != edge.src ||
+                                    kept[run_start].dest != edge.dest))
+      run_start = kept.size();
+    bool duplicate = false;
+    // Runs share (src, dest); weighted graphs keep one edge per weight.
+    for (size_t k = run_start; k < kept.size() && !duplicate; ++k)
+      duplicate = !rules.weighted || kept[k].weight == edge.weight;
+    if (!duplicate)
+      kept.push_back(std::move(edge));
+  }
+  return result;
+}
+
+} // namespace CinderPeak
@@ -0,0 +1,284 @@
+#pragma once
+#include "Operations/BulkBuild.hpp"
+#include "StorageEngine/ErrorCodes.hpp"
+#include "StorageEngine/MappedFile.hpp"
+#include "StorageEngine/ParallelUtils.hpp"
+#include "StorageEngine/Utils.hpp"
+#include <algorithm>
+#include <cctype>
+#include <charconv>
+#include <cstdint>
+#include <locale>
+#include <sstream>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+namespace CinderPeak {
+
+enum class EdgeListFormat : uint8_t {
+  // MatrixMarket when the file starts with a "%%MatrixMarket" banner,
+  // EdgeList otherwise.
+  Auto,
+  // One edge per line: "src dest [weight]", separated by spaces, tabs or
+  // commas; weighted graphs require the weight. Lines starting with '#' or
+  // '%' are comments.
+  EdgeList,
+  // Matrix Market coordinate format (real, integer or pattern entries).
+  MatrixMarket
+};
+
+struct EdgeListImportOptions {
+  EdgeListFormat format = EdgeListFormat::Auto;
+  // Parser threads; 0 picks one per hardware thread for large inputs.
+  size_t workers = 0;
+};
+
+namespace PeakStore {
+
+// Average bytes per edge line assumed when sizing the worker pool.
+inline constexpr size_t IMPORT_BYTES_PER_LINE = 16;
+
+inline bool isFieldSeparator(char c) {
+  return c == ' ' || c == '\t' || c == ',' || c == '\r';
+}
+
+inline const char *skipSeparators(const char *pos, const char *end) {
+  while (pos < end && isFieldSeparator(*pos))
+    ++pos;
+  return pos;
+}
+
+// Parses one number at pos and moves pos past it. No locale, no copies.
+template <typename T>
+bool parseNumber(const char *&pos, const char *end, T &value) {
+  if (pos < end && *pos == '+')
+    ++pos;
+  if constexpr (std::is_integral_v<T>) {
+    auto [next, ec] = std::from_chars(pos, end, value);
+    if (ec != std::errc())
+      return false;
+    pos = next;
+    return true;
+  } else {
+#if defined(__cpp_lib_to_chars)
+    auto [next, ec] = std::from_chars(pos, end, value);
+    if (ec != std::errc())
+      return false;
+    pos = next;
+    return true;
+#else
+    // No floating-point from_chars: strtod would follow the global locale,
+    // so read the field with a stream pinned to the classic one.
+    size_t len = 0;
+    while (pos + len < end && !isFieldSeparator(pos[len]) && pos[len] != '\n')
+      ++len;
+    std::istringstream in(std::string(pos, len));
+    in.imbue(std::locale::classic());
+    double parsed = 0;
+    if (!(in >> parsed))
+      return false;
+    value = static_cast<T>(parsed);
+    pos += in.eof() ? len : static_cast<size_t>(in.tellg());
+    return true;
+#endif
+  }
+}
+
+/**
+ * @brief Parses an edge-list or Matrix Market file into a BulkEdgeSet.
+ *
+ * The file is mmapped and split at line boundaries into one byte range per
+ * worker. Each worker parses its range with from_chars into a local edge
+ * buffer; the buffers are then handed to buildEdgeSet, which interns,
+ * sorts and deduplicates in parallel. No graph API is called per edge.
+ *
+ * Vertex ids are read as VertexType, which must be integral. Weights are
+ * read from the third column on weighted graphs, where a line without one
+ * is an error (except in pattern Matrix Market files), and ignored
+ * otherwise; any other trailing field makes the line an error. Weighted
+ * graphs need an arithmetic EdgeType.
+ * Matrix Market files add every index 1..max(rows, cols) as a vertex, and
+ * symmetric matrices are mirrored. Errors name the offending line.
+ */
+template <typename VertexType, typename EdgeType>
+std::pair<BulkEdgeSet<VertexType, EdgeType>, PeakStatus>
+readEdgeListFile(const std::string &path, const EdgeInsertRules &rules,
+                 const EdgeListImportOptions &options =
+                     EdgeListImportOptions()) {
+  static_assert(std::is_integral_v<VertexType>,
+                "Edge list import needs an integral vertex type");
+  constexpr bool hasWeight = std::is_arithmetic_v<EdgeType>;
+  using Edge = std::tuple<VertexType, VertexType, EdgeType>;
+  using Result = std::pair<BulkEdgeSet<VertexType, EdgeType>, PeakStatus>;
+
+  if (rules.weighted && !hasWeight)
+    return Result({}, PeakStatus::InvalidArgument(
+                          "Weighted edge list import needs an arithmetic "
+                          "edge type: " +
+                          path));
+
+  auto [file, status] = MappedFile::open(path);
+  if (!status.isOK())
+    return Result({}, status);
+  const char *const begin = file.data();
+  const char *const end = begin + file.size();
+  auto lineOf = [&](const char *at) {
+    return std::to_string(1 + std::count(begin, at, '\n'));
+  };
+  auto nextLine = [end](const char *at) {
+    const char *eol = std::find(at, end, '\n');
+    return eol < end ? eol + 1 : end;
+  };
+
+  // Matrix Market header: banner, comments, then "rows cols entries".
+  const char *body = begin;
+  bool matrixMarket = options.format == EdgeListFormat::MatrixMarket;
+  if (options.format == EdgeListFormat::Auto) {
+    static const std::string banner = "%%MatrixMarket";
+    matrixMarket = file.size() >= banner.size() &&
+                   std::equal(banner.begin(), banner.end(), begin);
+  }
+  bool symmetric = false;
+  bool skew = false;
+  bool pattern = false;
+  uint64_t dimension = 0;
+  if (matrixMarket) {
+    const char *eol = std::find(begin, end, '\n');
+    std::string header(begin, eol);
+    std::transform(header.begin(), header.end(), header.begin(),
+                   [](unsigned char c) { return std::tolower(c); });
+    if (header.rfind("%%matrixmarket matrix coordinate", 0) != 0)
+      return Result({}, PeakStatus::InvalidArgument(
+                            "Only coordinate Matrix Market files are "
+                            "supported: " +
+                            path));
+    if (header.find("complex") != std::string::npos)
+      return Result({}, PeakStatus::InvalidArgument(
+                            "Complex Matrix Market entries are not "
+                            "supported: " +
+                            path));
+    pattern = header.find("pattern") != std::string::npos;
+    symmetric = header.find("general") == std::string::npos;
+    skew = header.find("skew-symmetric") != std::string::npos;
+
+    bool sized = false;
+    for (body = nextLine(begin); body < end && !sized; body = nextLine(body)) {
+      const char *line = skipSeparators(body, end);
+      if (line == end || *line == '%' || *line == '\n')
+        continue;
+      uint64_t rows = 0, cols = 0, entries = 0;
+      const char *pos = line;
+      if (!parseNumber(pos, end, rows) ||
+          !parseNumber(pos = skipSeparators(pos, end), end, cols) ||
+          !parseNumber(pos = skipSeparators(pos, end), end, entries))
+        return Result({}, PeakStatus::InvalidArgument(
+                              "Bad Matrix Market size line " + lineOf(line)));
+      dimension = std::max(rows, cols);
+      sized = true;
+    }
+    if (!sized)
+      return Result({}, PeakStatus::InvalidArgument(
+                            "Matrix Market size line missing: " + path));
+  }
+
+  const size_t bytes = static_cast<size_t>(end - body);
+  size_t workers = options.workers;
+  if (workers == 0)
+    workers = workerCount(bytes / IMPORT_BYTES_PER_LINE);
+
+  std::vector<std::vector<Edge>> parts(workers);
+  std::vector<const char *> errors(workers, nullptr);
+  parallelFor(bytes, workers, [&](size_t w, size_t lo, size_t hi) {
+    const char *pos = body + lo;
+    const char *stop = body + hi;
+    // A range owns the lines that start inside it.
+    if (lo > 0 && pos[-1] != '\n')
+      pos = nextLine(pos);
+    auto &out = parts[w];
+    out.reserve((hi - lo) / IMPORT_BYTES_PER_LINE);
+    while (pos < stop && pos < end) {
+      const char *line = pos;
+      const char *eol = std::find(pos, end, '\n');
+      pos = skipSeparators(pos, eol);
+      if (pos == eol || *pos == '#' || *pos == '%') {
+        pos = nextLine(eol);
+        continue;
+      }
+      VertexType src{}, dest{};
+      EdgeType weight{};
+      bool ok = parseNumber(pos, eol, src) &&
+                parseNumber(pos = skipSeparators(pos, eol), eol, dest);
+      bool weightRead = false;
+      if constexpr (hasWeight) {
+        pos = skipSeparators(pos, eol);
+        if (ok && rules.weighted && !pattern && pos < eol) {
+          ok = parseNumber(pos, eol, weight);
+          weightRead = true;
+        } else if (ok && !pattern && rules.weighted) {
+          ok = false;
+        }
+      }
+      pos = skipSeparators(pos, eol);
+      if (ok && !weightRead && pos < eol) {
+        // A weight column the graph does not use must still be a number.
+        double ignored = 0;
+        ok = parseNumber(pos, eol, ignored);
+      }
+      // Anything left after the last field ("1 2x", a fractional weight on
+      // an integral EdgeType) is an error rather than silently dropped.
+      ok = ok && skipSeparators(pos, eol) == eol;
+      if (ok && matrixMarket &&
+          (src < 1 || dest < 1 || static_cast<uint64_t>(src) > dimension ||
+           static_cast<uint64_t>(dest) > dimension))
+        ok = false;
+      if (!ok) {
+        errors[w] = line;
+        return;
+      }
+      if (symmetric && src != dest && rules.directed) {
+        EdgeType mirrored = weight;
+        if constexpr (hasWeight && std::is_signed_v<EdgeType>) {
+          if (skew)
+            mirrored = -weight;
+        }
+        out.emplace_back(dest, src, mirrored);
+      }
+      out.emplace_back(src, dest, weight);
+      pos = nextLine(eol);
+    }
+  });
+  for (const char *error : errors) {
+    if (error)
+      return Result({}, PeakStatus::InvalidArgument(
+                            "Cannot parse edge on line " + lineOf(error) +
+                            " of " + path));
+  }
+
+  std::vector<Edge> edges;
+  size_t total = 0;
+  for (const auto &part : parts)
+    total += part.size();
+  edges.reserve(total);
+  for (auto &part : parts) {
+    edges.insert(edges.end(), part.begin(), part.end());
+    std::vector<Edge>().swap(part);
+  }
+
+  auto set = buildEdgeSet<VertexType, EdgeType>(edges, rules, workers);
+  if (matrixMarket && set.vertices.size() < dimension) {
+    std::unordered_set<VertexType> present(set.vertices.begin(),
+                                           set.vertices.end());
+    for (uint64_t v = 1; v <= dimension; ++v) {
+      if (!present.count(static_cast<VertexType>(v)))
+        set.vertices.push_back(static_cast<VertexType>(v));
+    }
+  }
+  return Result(std::move(set), PeakStatus::OK());
+}
+
+} // namespace PeakStore
+} // namespace CinderPeak
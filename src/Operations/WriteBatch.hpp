@@ -0,0 +1,123 @@
+#pragma once
+#include "StorageEngine/ErrorCodes.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace CinderPeak {
+
+enum class BatchOpKind : uint8_t {
+  AddVertex,
+  RemoveVertex,
+  AddEdge,
+  RemoveEdge,
+  UpdateEdge
+};
+
+/**
+ * @brief Ordered list of graph mutations applied together by apply().
+ *
+ * The batch only records operations; nothing touches the graph until it is
+ * applied. Vertex operations leave dest and weight default constructed.
+ *
+ * @tparam VertexType Vertex representation type.
+ * @tparam EdgeType Edge or edge-weight representation type.
+ */
+template <typename VertexType, typename EdgeType> class WriteBatch {
+public:
+  struct Op {
+    BatchOpKind kind;
+    VertexType src;
+    VertexType dest;
+    EdgeType weight;
+  };
+
+  WriteBatch &addVertex(const VertexType &v) {
+    _ops.push_back({BatchOpKind::AddVertex, v, VertexType(), EdgeType()});
+    return *this;
+  }
+
+  WriteBatch &removeVertex(const VertexType &v) {
+    _ops.push_back({BatchOpKind::RemoveVertex, v, VertexType(), EdgeType()});
+    return *this;
+  }
+
+  WriteBatch &addEdge(const VertexType &src, const VertexType &dest,
+                      const EdgeType &weight = EdgeType()) {
+    _ops.push_back({BatchOpKind::AddEdge, src, dest, weight});
+    return *this;
+  }
+
+  WriteBatch &removeEdge(const VertexType &src, const VertexType &dest) {
+    _ops.push_back({BatchOpKind::RemoveEdge, src, dest, EdgeType()});
+    return *this;
+  }
+
+  WriteBatch &updateEdge(const VertexType &src, const VertexType &dest,
+                         const EdgeType &newWeight) {
+    _ops.push_back({BatchOpKind::UpdateEdge, src, dest, newWeight});
+    return *this;
+  }
+
+  void reserve(size_t count) { _ops.reserve(count); }
+  void clear() { _ops.clear(); }
+  size_t size() const { return _ops.size(); }
+  bool empty() const { return _ops.empty(); }
+  const std::vector<Op> &ops() const { return _ops; }
+
+private:
+  std::vector<Op> _ops;
+};
+
+/**
+ * @brief Outcome of applying a WriteBatch.
+ *
+ * applied[i] is set when operation i took effect. Failed operations are
+ * skipped and the rest of the batch still runs; firstError keeps the status
+ * of the earliest failure. The counters are the net change to feed into the
+ * graph metadata, with undirected edges counted once per stored direction.
+ */
+struct BatchResult {
+  std::vector<bool> applied;
+  PeakStatus firstError = PeakStatus::OK();
+  size_t failed = 0;
+  size_t verticesAdded = 0;
+  size_t verticesRemoved = 0;
+  size_t edgesAdded = 0;
+  size_t edgesRemoved = 0;
+
+  BatchResult() = default;
+  explicit BatchResult(size_t opCount) : applied(opCount, false) {}
+
+  bool allApplied() const { return failed == 0; }
+
+  // Records the status of operation index; directions is 2 for edge
+  // operations on an undirected graph and 1 otherwise.
+  void record(size_t index, BatchOpKind kind, const PeakStatus &status,
+              size_t directions) {
+    if (!status.isOK()) {
+      if (failed++ == 0)
+        firstError = status;
+      return;
+    }
+    applied[index] = true;
+    switch (kind) {
+    case BatchOpKind::AddVertex:
+      ++verticesAdded;
+      break;
+    case BatchOpKind::RemoveVertex:
+      ++verticesRemoved;
+      break;
+    case BatchOpKind::AddEdge:
+      edgesAdded += directions;
+      break;
+    case BatchOpKind::RemoveEdge:
+      edgesRemoved += directions;
+      break;
+    case BatchOpKind::UpdateEdge:
+      break;
+    }
+  }
+};
+
+} // namespace CinderPeak
@@ -1,12 +1,14 @@
 #pragma once
 #include "Algorithms/CinderPeakAlgorithms.hpp"
 #include "CinderPeak.hpp"
-#include "Constraints/Constraints.hpp"
 #include "Events/DefaultListeners.hpp"
 #include "GraphConstraints.hpp"
 #include "GraphEvents.hpp"
 #include "GraphRuntime.hpp"
-#include "Operations/GraphOperations.hpp"
+#include "GraphSnapshot.hpp"
+#include "Operations/BulkBuild.hpp"
+#include "Operations/EdgeListImport.hpp"
+#include "Operations/WriteBatch.hpp"
 #include "PeakLogger.hpp"
 #include "StorageEngine/AdjacencyList.hpp"
 #include "StorageEngine/DebugUtils.hpp"
@@ -15,40 +17,79 @@
 #include "StorageEngine/GraphStatistics.hpp"
 #include "StorageEngine/HybridCSR_COO.hpp"
 #include "StorageEngine/Utils.hpp"
+#include "StoragePolicy.hpp"
 #include <cassert>
 #include <fstream>
+#include <cstddef>
 #include <iostream>
 #include <memory>
+#include <memory_resource>
+#include <optional>
 #include <vector>
 
 namespace CinderPeak {
 namespace PeakStore {
 
-template <typename VertexType, typename EdgeType> class PeakStore {
+// StoragePolicy (see StoragePolicy.hpp) fixes the static type every impl_*
+// call goes through; the default keeps virtual dispatch.
+template <typename VertexType, typename EdgeType, typename StoragePolicy>
+class PeakStore {
+public:
+  using LookupKey = VertexLookupKey<VertexType>;
+  using Storage = typename StoragePolicy::template type<VertexType, EdgeType>;
+
 private:
   std::shared_ptr<GraphContext<VertexType, EdgeType>> ctx = nullptr;
+
+  Storage *storage() const { return StoragePolicy::bind(*ctx); }
+  using Frame = WalFrameWriter<VertexType, EdgeType>;
+  // Context objects and storages all live on the options' memory resource.
+  using ContextAllocator = std::pmr::polymorphic_allocator<std::byte>;
+
   void initializeContext(const GraphInternalMetadata &metadata,
                          const GraphCreationOptions &options) {
-    ctx->metadata = std::make_shared<GraphInternalMetadata>(metadata);
-    ctx->create_options = std::make_shared<GraphCreationOptions>(options);
+    std::pmr::memory_resource *resource = options.memoryResource();
+    ContextAllocator alloc(resource);
+    ctx->metadata =
+        std::allocate_shared<GraphInternalMetadata>(alloc, metadata);
+    ctx->create_options =
+        std::allocate_shared<GraphCreationOptions>(alloc, options);
     ctx->hybrid_storage =
-        std::make_shared<HybridCSR_COO<VertexType, EdgeType>>();
-    ctx->runtime = std::make_shared<CinderPeak::GraphRuntime>();
+        std::allocate_shared<HybridCSR_COO<VertexType, EdgeType>>(alloc,
+                                                                  resource);
+    ctx->runtime = std::allocate_shared<CinderPeak::GraphRuntime>(alloc);
     ctx->adjacency_storage =
-        std::make_shared<AdjacencyList<VertexType, EdgeType>>(*ctx->runtime);
+        std::allocate_shared<AdjacencyList<VertexType, EdgeType>>(
+            alloc, *ctx->runtime, resource);
     ctx->active_storage = ctx->adjacency_storage;
-    ctx->algorithms = std::make_shared<
+    ctx->algorithms = std::allocate_shared<
         Algorithms::CinderPeakAlgorithms<VertexType, EdgeType>>(
-        ctx->hybrid_storage);
+        alloc, ctx->hybrid_storage);
     ctx->runtime->log(LogLevel::CRITICAL, "Log from ctx\n");
     registerMetadataListeners(*ctx);
+    registerHybridSyncListeners(*ctx);
+  }
+
+  // Reloads the hybrid CSR from the adjacency list if a mutation happened
+  // since the last load. The flag is cleared before exporting, so a write
+  // racing the export marks it stale again.
+  void syncHybridStorage() const {
+    std::lock_guard<std::mutex> lock(ctx->hybrid_sync_mtx);
+    if (!ctx->hybrid_stale.exchange(false, std::memory_order_acq_rel))
+      return;
+    ctx->hybrid_storage->loadEdgeSet(ctx->adjacency_storage->exportEdgeSet());
+  }
+
+  bool isDirected() const {
+    return ctx->create_options->hasOption(GraphCreationOptions::Directed);
   }
 
 public:
   PeakStore(const GraphInternalMetadata &metadata,
             const GraphCreationOptions &options =
                 CinderPeak::GraphCreationOptions::getDefaultCreateOptions())
-      : ctx(std::make_shared<GraphContext<VertexType, EdgeType>>()) {
+      : ctx(std::allocate_shared<GraphContext<VertexType, EdgeType>>(
+            ContextAllocator(options.memoryResource()))) {
     initializeContext(metadata, options);
     ctx->log(LogLevel::INFO, "Successfully initialized context object.");
     ctx->runtime->log(LogLevel::CRITICAL, "Log from ctx 1\n");
@@ -70,76 +111,108 @@ public:
           PeakStatus::VertexNotFound("Vertex Not Found During the BFS");
       return result;
     }
-    result = std::move(ctx->algorithms->bfs(src));
-    return result;
+    syncHybridStorage();
+    return ctx->algorithms->bfs(src, isDirected());
+  }
+
+  Algorithms::BFSResult<VertexType>
+  parallelBFS(const VertexType &src,
+              const Algorithms::ParallelBFSOptions &options) {
+    Algorithms::BFSResult<VertexType> result;
+    if (!hasVertex(src)) {
+      result._status =
+          PeakStatus::VertexNotFound("Vertex Not Found During the BFS");
+      return result;
+    }
+    syncHybridStorage();
+    return ctx->algorithms->parallelBFS(src, isDirected(), options);
+  }
+
+  Algorithms::ShortestPathResult<VertexType, EdgeType> shortestPaths(
+      const VertexType &src,
+      const std::optional<Algorithms::DeltaSteppingOptions> &options) {
+    Algorithms::ShortestPathResult<VertexType, EdgeType> result;
+    if (!hasVertex(src)) {
+      result._status = PeakStatus::VertexNotFound(
+          "Vertex Not Found During the shortest path search");
+      return result;
+    }
+    syncHybridStorage();
+    return ctx->algorithms->shortestPaths(src, isDirected(), options);
+  }
+
+  Algorithms::PageRankResult<VertexType>
+  pageRank(double damping, double tolerance, size_t maxIterations) {
+    syncHybridStorage();
+    return ctx->algorithms->pageRank(damping, tolerance, maxIterations,
+                                     isDirected());
+  }
+
+  Algorithms::ComponentsResult<VertexType> connectedComponents() {
+    syncHybridStorage();
+    return ctx->algorithms->connectedComponents(isDirected());
+  }
+
+  Algorithms::StrongComponentsResult<VertexType> stronglyConnectedComponents(
+      const std::optional<Algorithms::SCCOptions> &options) {
+    syncHybridStorage();
+    return ctx->algorithms->stronglyConnectedComponents(isDirected(),
+                                                        options);
+  }
+
+  Algorithms::TriangleCountResult<VertexType> countTriangles() {
+    syncHybridStorage();
+    return ctx->algorithms->countTriangles(isDirected());
   }
 
   PeakStatus addEdge(const VertexType &src, const VertexType &dest,
                      const EdgeType &weight = EdgeType()) {
-
-    AddEdgeOperation<VertexType, EdgeType> op{
-        *ctx,
-        src,
-        dest,
-        weight,
+    EdgeInsertRules rules{
         ctx->metadata->isGraphWeighted(),
         ctx->create_options->hasOption(GraphCreationOptions::Directed)};
-    PeakStatus validation = validateAddEdge(op);
-    if (!validation.isOK())
-      return validation;
-    if (op.weighted) {
+    if (rules.weighted) {
       ctx->log(LogLevel::INFO, "Called weighted PeakStore::addEdge for " +
                                    weightedEdgeStr(src, dest, weight));
     } else {
       ctx->log(LogLevel::INFO, "Called unweighted PeakStore::addEdge for " +
                                    edgeStr(src, dest));
     }
-    PeakStatus status;
-    if (op.weighted) {
-      status = ctx->active_storage->impl_addEdge(src, dest, weight);
-    } else {
-      status = ctx->active_storage->impl_addEdge(src, dest);
-    }
+    // The storage checks rules and inserts under one lock, so a concurrent
+    // writer cannot invalidate the checks. Undirected edges are written in
+    // both directions within that same lock hold.
+    const EdgeType &stored = rules.weighted ? weight : EdgeType();
+    WalTransaction wal(ctx->wal.get());
+    PeakStatus status =
+        rules.directed
+            ? storage()->impl_addEdgeChecked(src, dest, stored, rules)
+            : storage()->impl_addEdgePair(src, dest, stored, rules);
     if (!status.isOK())
       return status;
-    ctx->events.edgeAdded.emit({src, dest, weight});
-    if (!op.directed) {
-      PeakStatus rev_status;
-      if (op.weighted) {
-        rev_status = ctx->active_storage->impl_addEdge(dest, src, weight);
-      } else {
-        rev_status = ctx->active_storage->impl_addEdge(dest, src);
-      }
-      if (!rev_status.isOK()) {
-        // Propagate reverse-insert failure to caller so API reflects partial
-        // application rather than silently reporting full success.
-        return rev_status;
-      }
-      ctx->events.edgeAdded.emit({dest, src, weight});
-    }
-    return PeakStatus::OK();
+    if (wal.active())
+      wal.record(
+          Frame(WalRecordTag::Ops).op(BatchOpKind::AddEdge, src, dest, stored)
+              .finish());
+    ctx->events.edgeAdded.emit({src, dest, weight, !rules.directed});
+    return wal.commit();
   }
   std::pair<EdgeType, PeakStatus> removeEdge(const VertexType &src,
                                              const VertexType &dest) {
     ctx->log(LogLevel::INFO,
              "Called adjacency:removeEdge() for " + edgeStr(src, dest));
-    auto result = ctx->active_storage->impl_removeEdge(src, dest);
-    if (result.second.isOK()) {
-      GraphEvents<VertexType, EdgeType>::onEdgeRemove(*ctx, src, dest);
-
-      bool isDirected =
-          ctx->create_options->hasOption(GraphCreationOptions::Directed);
-      if (!isDirected && src != dest) {
-        auto rev_result = ctx->active_storage->impl_removeEdge(dest, src);
-        if (!rev_result.second.isOK()) {
-          // If reverse removal fails, propagate that failure to caller so the
-          // API can surface the partial failure instead of silently
-          // returning success.
-          return rev_result;
-        }
-        GraphEvents<VertexType, EdgeType>::onEdgeRemove(*ctx, dest, src);
-      }
-    }
+    bool isDirected =
+        ctx->create_options->hasOption(GraphCreationOptions::Directed);
+    WalTransaction wal(ctx->wal.get());
+    auto result = isDirected
+                      ? storage()->impl_removeEdge(src, dest)
+                      : storage()->impl_removeEdgePair(src, dest);
+    if (!result.second.isOK())
+      return result;
+    if (wal.active())
+      wal.record(Frame(WalRecordTag::Ops)
+                     .op(BatchOpKind::RemoveEdge, src, dest)
+                     .finish());
+    ctx->events.edgeRemoved.emit({src, dest, !isDirected});
+    result.second = wal.commit();
     return result;
   }
 
@@ -150,33 +223,204 @@ public:
                                  weightedEdgeStr(src, dest, newWeight));
 
     auto [currentWeight, currentStatus] =
-        ctx->active_storage->impl_getEdge(src, dest);
+        storage()->impl_getEdge(src, dest);
     if (!currentStatus.isOK()) {
       return {currentStatus, EdgeType()};
     }
 
+    WalTransaction wal(ctx->wal.get());
+    bool undirected =
+        ctx->create_options->hasOption(GraphCreationOptions::Undirected);
     PeakStatus resp =
-        ctx->active_storage->impl_updateEdge(src, dest, newWeight);
+        undirected ? storage()->impl_updateEdgePair(src, dest, newWeight)
+                   : storage()->impl_updateEdge(src, dest, newWeight);
     if (!resp.isOK()) {
       return {resp, EdgeType()};
     }
+    if (wal.active())
+      wal.record(Frame(WalRecordTag::Ops)
+                     .op(BatchOpKind::UpdateEdge, src, dest, newWeight)
+                     .finish());
+    ctx->events.edgeUpdated.emit({src, dest, newWeight, undirected});
 
-    if (ctx->create_options->hasOption(GraphCreationOptions::Undirected)) {
-      PeakStatus resp2 =
-          ctx->active_storage->impl_updateEdge(dest, src, newWeight);
-      if (!resp2.isOK()) {
-        return {resp2, EdgeType()};
-      }
+    return {wal.commit(), currentWeight};
+  }
+
+  // Loads an edge range into the (empty) graph in one pass. See
+  // buildEdgeSet for the accepted element types and duplicate rules.
+  template <typename EdgeContainer>
+  PeakStatus bulkLoad(const EdgeContainer &edges) {
+    ctx->log(LogLevel::INFO, "Called PeakStore::bulkLoad");
+    EdgeInsertRules rules{
+        ctx->metadata->isGraphWeighted(),
+        ctx->create_options->hasOption(GraphCreationOptions::Directed)};
+    return bulkLoadSet(buildEdgeSet<VertexType, EdgeType>(edges, rules));
+  }
+
+  // Loads an edge-list or Matrix Market file into the (empty) graph. See
+  // readEdgeListFile for the formats.
+  PeakStatus importFile(const std::string &path,
+                        const EdgeListImportOptions &options) {
+    ctx->log(LogLevel::INFO, "Called PeakStore::importFile for " + path);
+    EdgeInsertRules rules{
+        ctx->metadata->isGraphWeighted(),
+        ctx->create_options->hasOption(GraphCreationOptions::Directed)};
+    auto [set, status] =
+        readEdgeListFile<VertexType, EdgeType>(path, rules, options);
+    if (!status.isOK())
+      return status;
+    return bulkLoadSet(set);
+  }
+
+  PeakStatus bulkLoadSet(const BulkEdgeSet<VertexType, EdgeType> &set) {
+    WalTransaction wal(ctx->wal.get());
+    PeakStatus status = ctx->adjacency_storage->bulkLoad(set);
+    if (!status.isOK())
+      return status;
+    if (wal.active()) {
+      // Logged as plain inserts, split into frames below maxFrameBytes and
+      // replayed through apply().
+      WalOpsRecorder<VertexType, EdgeType> ops(wal);
+      for (const auto &v : set.vertices)
+        ops.op(BatchOpKind::AddVertex, v);
+      for (const auto &edge : set.edges)
+        ops.op(BatchOpKind::AddEdge, set.vertices[edge.src - 1],
+               set.vertices[edge.dest - 1], edge.weight);
+      ops.flush();
     }
+    ctx->metadata->applyCountDelta(set.vertices.size(), 0,
+                                   set.storedEdgeCount(), 0);
+    ctx->events.cleared.emit({true});
+    return wal.commit();
+  }
 
-    return {PeakStatus::OK(), currentWeight};
+  BulkEdgeSet<VertexType, EdgeType> exportEdgeSet() const {
+    return ctx->adjacency_storage->exportEdgeSet();
   }
 
-  std::pair<EdgeType, PeakStatus> getEdge(const VertexType &src,
-                                          const VertexType &dest) {
-    ctx->log(LogLevel::INFO,
-             "Called adjacency:getEdge() for " + edgeStr(src, dest));
-    auto status = ctx->active_storage->impl_getEdge(src, dest);
+  GraphSnapshot<VertexType, EdgeType> snapshot() const {
+    ctx->log(LogLevel::INFO, "Called PeakStore::snapshot");
+    auto &storage = ctx->adjacency_storage;
+    return GraphSnapshot<VertexType, EdgeType>(storage,
+                                               storage->openSnapshot());
+  }
+
+  /**
+   * Replays the log at path into this graph, then appends every later
+   * successful mutation to it. Call before other threads use the graph.
+   * Returns the number of records replayed.
+   */
+  std::pair<size_t, PeakStatus>
+  enableWriteAheadLog(const std::string &path,
+                      const WalOptions &options = WalOptions()) {
+    static_assert(WalCodec<VertexType>::supported &&
+                      WalCodec<EdgeType>::supported,
+                  "Specialize CinderPeak::WalCodec for the vertex and edge "
+                  "types to use a write-ahead log");
+    ctx->log(LogLevel::INFO, "Called PeakStore::enableWriteAheadLog " + path);
+    if (ctx->wal)
+      return {0, PeakStatus::AlreadyExists("A write-ahead log is attached.")};
+
+    auto replayed = replayWriteAheadLog<VertexType, EdgeType>(
+        path, [this](WalRecordTag tag,
+                     const WriteBatch<VertexType, EdgeType> &batch) {
+          if (tag == WalRecordTag::ClearVertices)
+            (void)clearVertices();
+          else if (tag == WalRecordTag::ClearEdges)
+            (void)clearEdges();
+          else
+            (void)apply(batch);
+        });
+    if (!replayed.second.isOK())
+      return replayed;
+
+    auto [log, status] = WriteAheadLog::open(path, options);
+    if (!status.isOK())
+      return {replayed.first, status};
+    ctx->wal = std::move(log);
+    return replayed;
+  }
+
+  // Forces every logged mutation to disk, whatever the sync policy.
+  PeakStatus syncWriteAheadLog() {
+    if (!ctx->wal)
+      return PeakStatus::NotFound("No write-ahead log is attached.");
+    return ctx->wal->sync();
+  }
+
+  // Syncs and closes the log; later mutations are no longer logged.
+  PeakStatus disableWriteAheadLog() {
+    PeakStatus status = syncWriteAheadLog();
+    ctx->wal.reset();
+    return status;
+  }
+
+  /**
+   * Caches up to capacity materialised getNeighbors() rows, invalidated
+   * through the EventHub. Later calls resize (and empty) the cache; 0 turns
+   * it off. Call before other threads use the graph.
+   */
+  void enableNeighborCache(size_t capacity) {
+    ctx->log(LogLevel::INFO, "Called PeakStore::enableNeighborCache");
+    if (ctx->neighbor_cache) {
+      ctx->neighbor_cache->resize(capacity);
+      return;
+    }
+    if (capacity == 0)
+      return;
+    // Listeners cannot be unsubscribed, so the cache object lives as long
+    // as the context once created.
+    auto cache =
+        std::make_shared<NeighborCache<VertexType, EdgeType>>(capacity);
+    registerNeighborCacheListeners(
+        *ctx, cache,
+        ctx->create_options->hasOption(GraphCreationOptions::Undirected));
+    ctx->neighbor_cache = std::move(cache);
+  }
+
+  NeighborCacheStats neighborCacheStats() const {
+    if (!ctx->neighbor_cache)
+      return {};
+    return ctx->neighbor_cache->stats();
+  }
+
+  const GraphCreationOptions &getCreateOptions() const {
+    return *ctx->create_options;
+  }
+
+  BatchResult apply(const WriteBatch<VertexType, EdgeType> &batch) {
+    ctx->log(LogLevel::INFO, "Called PeakStore::apply for a batch of " +
+                                 std::to_string(batch.size()) + " operations");
+    EdgeInsertRules rules{
+        ctx->metadata->isGraphWeighted(),
+        ctx->create_options->hasOption(GraphCreationOptions::Directed)};
+    WalTransaction wal(ctx->wal.get());
+    BatchResult result = storage()->impl_applyBatch(batch, rules);
+    if (wal.active()) {
+      // Only the operations that took effect, as one record unless the
+      // batch outgrows maxFrameBytes.
+      WalOpsRecorder<VertexType, EdgeType> recorder(wal);
+      const auto &ops = batch.ops();
+      for (size_t i = 0; i < ops.size(); ++i) {
+        if (result.applied[i])
+          recorder.op(ops[i].kind, ops[i].src, ops[i].dest, ops[i].weight);
+      }
+      recorder.flush();
+    }
+    // One event and one metadata update for the whole batch.
+    ctx->events.batchApplied.emit({batch, result});
+    // A log failure is reported like a failed operation would be.
+    if (PeakStatus status = wal.commit();
+        !status.isOK() && result.firstError.isOK())
+      result.firstError = status;
+    return result;
+  }
+
+  std::pair<EdgeType, PeakStatus> getEdge(LookupKey src, LookupKey dest) {
+    if (isLoggingEnabled())
+      ctx->log(LogLevel::INFO,
+               "Called adjacency:getEdge() for " + edgeStr(src, dest));
+    auto status = storage()->impl_getEdge(src, dest);
     if (!status.second.isOK()) {
       return {EdgeType(), status.second};
     }
@@ -186,26 +430,42 @@ public:
   PeakStatus addVertex(const VertexType &src) {
     ctx->log(LogLevel::INFO,
              "Called peakStore:addVertex for " + vertexStr(src));
-    if (PeakStatus resp = ctx->active_storage->impl_addVertex(src);
+    WalTransaction wal(ctx->wal.get());
+    if (PeakStatus resp = storage()->impl_addVertex(src);
         !resp.isOK())
       return resp;
+    if (wal.active())
+      wal.record(
+          Frame(WalRecordTag::Ops).op(BatchOpKind::AddVertex, src).finish());
     ctx->metadata->updateVertexCount(UpdateOp::Add);
+    ctx->events.vertexAdded.emit({src});
 
-    return PeakStatus::OK();
+    return wal.commit();
   }
 
-  bool hasVertex(const VertexType &v) {
-    ctx->log(LogLevel::INFO, "Called peakStore:hasVertex for " + vertexStr(v));
-    return ctx->active_storage->impl_hasVertex(v);
+  bool hasVertex(LookupKey v) {
+    if (isLoggingEnabled())
+      ctx->log(LogLevel::INFO,
+               "Called peakStore:hasVertex for " + vertexStr(v));
+    return storage()->impl_hasVertex(v);
   }
 
   const std::pair<std::vector<std::pair<VertexType, EdgeType>>, PeakStatus>
-  getNeighbors(const VertexType &src) const {
-    ctx->log(LogLevel::INFO,
-             "Called adjacency:getNeighbors() for " + vertexStr(src));
+  getNeighbors(LookupKey src) const {
+    if (isLoggingEnabled())
+      ctx->log(LogLevel::INFO,
+               "Called adjacency:getNeighbors() for " + vertexStr(src));
+    auto *cache = ctx->neighbor_cache.get();
+    if (cache) {
+      if (auto row = cache->find(src))
+        return {std::move(*row), PeakStatus::OK()};
+    }
+    uint64_t epoch = cache ? cache->epoch() : 0;
     auto status = ctx->adjacency_storage->impl_getNeighbors(src);
     if (!status.second.isOK()) {
       std::cout << status.second.message() << "\n";
+    } else if (cache) {
+      cache->insert(src, status.first, epoch);
     }
     return status;
   }
@@ -216,28 +476,44 @@ public:
   }
 
   PeakStatus removeVertex(const VertexType &v) {
-    auto status = ctx->active_storage->impl_removeVertex(v);
+    WalTransaction wal(ctx->wal.get());
+    auto status = storage()->impl_removeVertex(v);
     if (status.isOK()) {
+      if (wal.active())
+        wal.record(
+            Frame(WalRecordTag::Ops).op(BatchOpKind::RemoveVertex, v).finish());
       ctx->metadata->updateVertexCount(UpdateOp::Remove);
+      ctx->events.vertexRemoved.emit({v});
+      status = wal.commit();
     }
     return status;
   }
 
   PeakStatus clearVertices() {
     ctx->log(LogLevel::INFO, "Called peakStore:clearVertices");
-    auto status = ctx->active_storage->impl_clearVertices();
+    WalTransaction wal(ctx->wal.get());
+    auto status = storage()->impl_clearVertices();
     if (status.isOK()) {
+      if (wal.active())
+        wal.record(Frame(WalRecordTag::ClearVertices).finish());
       ctx->metadata->updateVertexCount(UpdateOp::Clear);
       ctx->metadata->updateEdgeCount(UpdateOp::Clear);
+      ctx->events.cleared.emit({true});
+      status = wal.commit();
     }
     return status;
   }
 
   PeakStatus clearEdges() {
     ctx->log(LogLevel::INFO, "Called peakStore:clearEdges");
-    auto status = ctx->active_storage->impl_clearEdges();
+    WalTransaction wal(ctx->wal.get());
+    auto status = storage()->impl_clearEdges();
     if (status.isOK()) {
+      if (wal.active())
+        wal.record(Frame(WalRecordTag::ClearEdges).finish());
       ctx->metadata->updateEdgeCount(UpdateOp::Clear);
+      ctx->events.cleared.emit({false});
+      status = wal.commit();
     }
     return status;
   }
@@ -252,6 +528,15 @@ public:
   }
   void unsetFileLogging() { ctx->runtime->disableFileLogging(); }
 
+  template <typename Fn> auto runAsync(Fn &&fn) const {
+    return ctx->runtime->async(std::forward<Fn>(fn));
+  }
+  void waitAsync() const { ctx->runtime->waitAsync(); }
+  void setAsyncWorkers(size_t threads) {
+    ctx->runtime->setAsyncWorkers(threads);
+  }
+  size_t asyncWorkers() const { return ctx->runtime->asyncWorkers(); }
+
   size_t numEdges() const { return ctx->metadata->numEdges(); }
 
   size_t numVertices() const {
@@ -292,14 +577,18 @@ public:
   void log(const LogLevel &level, const std::string &message) const {
     ctx->runtime->log(level, message);
   }
+  void log(const LogLevel &level, const char *message) const {
+    ctx->runtime->log(level, message);
+  }
+  bool isLoggingEnabled() const { return ctx->runtime->isLoggingEnabled(); }
 
   std::vector<VertexType> getVertices() const {
-    return ctx->active_storage->impl_getVertices();
+    return storage()->impl_getVertices();
   }
 
   std::vector<std::tuple<VertexType, VertexType, EdgeType>>
   getEdgeList() const {
-    return ctx->active_storage->impl_getEdgeList();
+    return storage()->impl_getEdgeList();
   }
 };
 
@@ -2,41 +2,420 @@
 #include "Concepts.hpp"
 #include "DebugUtils.hpp"
 #include "GraphRuntime.hpp"
+#include "Operations/BulkBuild.hpp"
+#include "Operations/WriteBatch.hpp"
+#include "ReadMostlyMutex.hpp"
+#include "SmallVector.hpp"
 #include "StorageEngine/GraphContext.hpp"
 #include "StorageEngine/GraphStatistics.hpp"
+#include "StorageEngine/SnapshotState.hpp"
 #include "Utils.hpp"
+#include "VertexIndex.hpp"
 #include <algorithm>
 #include <atomic>
 #include <memory>
+#include <memory_resource>
 #include <optional>
 #include <shared_mutex>
+#include <tuple>
+#include <vector>
 
 namespace CinderPeak {
 template <typename, typename> class PeakStorageInterface;
 
 namespace PeakStore {
 
-template <typename VertexType, typename EdgeType>
-class AdjacencyList
+// InlineNeighbors defaults to DEFAULT_INLINE_NEIGHBORS (see StoragePolicy.hpp).
+// Final, so calls through an AdjacencyList pointer bind statically (see
+// AdjacencyStorage).
+template <typename VertexType, typename EdgeType, size_t InlineNeighbors>
+class AdjacencyList final
     : public CinderPeak::PeakStorageInterface<VertexType, EdgeType> {
+public:
+  using LookupKey = VertexLookupKey<VertexType>;
+  // Rows up to InlineNeighbors long live inside the _adj node itself.
+  using Neighbor = std::pair<CinderPeak::VertexId, EdgeType>;
+  using NeighborList = SmallVector<Neighbor, InlineNeighbors,
+                                   std::pmr::polymorphic_allocator<Neighbor>>;
+  using Snapshot = SnapshotState<VertexType, EdgeType>;
+
 private:
-  std::unordered_map<CinderPeak::VertexId,
-                     std::vector<std::pair<CinderPeak::VertexId, EdgeType>>>
-      _adj;
-  std::unordered_map<CinderPeak::VertexId, VertexType> _vertex_data;
-  std::unordered_map<VertexType, CinderPeak::VertexId, VertexHasher<VertexType>>
-      _vertex_lookup;
+  // All containers allocate from the memory resource given at construction,
+  // including spilled neighbor rows.
+  std::pmr::unordered_map<CinderPeak::VertexId, NeighborList> _adj;
+  // Vertex values are held once by _vertex_lookup; _vertex_data only keeps
+  // the key needed to read them back (an InternId for string vertices).
+  using VertexKey = typename VertexIndex<VertexType, VertexId>::key_type;
+  std::pmr::unordered_map<CinderPeak::VertexId, VertexKey> _vertex_data;
+  VertexIndex<VertexType, CinderPeak::VertexId> _vertex_lookup;
 
   std::atomic<CinderPeak::VertexId> _next_vertex_id{1};
+  // Ids of removed vertices, reused (LIFO) before _next_vertex_id grows.
+  std::pmr::vector<CinderPeak::VertexId> _free_ids;
   const GraphRuntime &runtime;
-  mutable std::shared_mutex _mtx;
+  // Sharded so concurrent readers (hasVertex, getEdge, ...) do not contend
+  // on a single reader count.
+  mutable ReadMostlyMutex _mtx;
+
+  // Open snapshots. Writers save pre-images into each before changing data;
+  // entries whose last handle was dropped are pruned on the next write.
+  std::vector<std::weak_ptr<Snapshot>> _snapshots;
+  uint64_t _snapshot_sequence = 0;
 
   std::optional<CinderPeak::VertexId>
-  lookupVertexId_nolock(const VertexType &v) const {
-    auto it = _vertex_lookup.find(v);
-    if (it == _vertex_lookup.end())
+  lookupVertexId_nolock(LookupKey v) const {
+    return _vertex_lookup.find(v);
+  }
+
+  VertexType vertexValue_nolock(const VertexKey &key) const {
+    return VertexType(_vertex_lookup.value(key));
+  }
+
+  template <typename Fn> void forEachSnapshot_nolock(Fn &&fn) {
+    for (size_t i = 0; i < _snapshots.size();) {
+      if (auto state = _snapshots[i].lock()) {
+        if (!state->detached)
+          fn(*state);
+        ++i;
+      } else {
+        _snapshots[i] = std::move(_snapshots.back());
+        _snapshots.pop_back();
+      }
+    }
+  }
+
+  void saveRow_nolock(Snapshot &state, CinderPeak::VertexId id) const {
+    if (state.rows.count(id))
+      return;
+    auto it = _adj.find(id);
+    if (it == _adj.end())
+      state.rows.emplace(id, std::nullopt);
+    else
+      state.rows.emplace(id, typename Snapshot::Row(it->second.begin(),
+                                                    it->second.end()));
+  }
+
+  void saveVertex_nolock(Snapshot &state, CinderPeak::VertexId id,
+                         const VertexType &v) const {
+    if (!state.vertices.count(id)) {
+      auto it = _vertex_data.find(id);
+      if (it == _vertex_data.end())
+        state.vertices.emplace(id, std::nullopt);
+      else
+        state.vertices.emplace(id, vertexValue_nolock(it->second));
+    }
+    if (!state.ids.find(v))
+      state.ids.save(v, lookupVertexId_nolock(v));
+  }
+
+  // Call before modifying row id. A no-op while no snapshot is open.
+  void preserveRow_nolock(CinderPeak::VertexId id) {
+    if (_snapshots.empty())
+      return;
+    forEachSnapshot_nolock([&](Snapshot &state) { saveRow_nolock(state, id); });
+  }
+
+  // Call before v gains or loses id. Saves its row as well.
+  void preserveVertex_nolock(CinderPeak::VertexId id, const VertexType &v) {
+    if (_snapshots.empty())
+      return;
+    forEachSnapshot_nolock([&](Snapshot &state) {
+      saveVertex_nolock(state, id, v);
+      saveRow_nolock(state, id);
+    });
+  }
+
+  // Call before rewriting the storage wholesale: copies everything not yet
+  // saved into every open snapshot and detaches it from the live data.
+  void detachSnapshots_nolock() {
+    if (_snapshots.empty())
+      return;
+    forEachSnapshot_nolock([&](Snapshot &state) {
+      for (const auto &[id, key] : _vertex_data) {
+        saveVertex_nolock(state, id, vertexValue_nolock(key));
+        saveRow_nolock(state, id);
+      }
+      state.detached = true;
+    });
+  }
+
+  std::optional<CinderPeak::VertexId>
+  snapshotVertexId_nolock(const Snapshot &state, LookupKey v) const {
+    if (!state.ids.empty()) {
+      if (auto saved = state.ids.find(v))
+        return *saved;
+    }
+    if (state.detached)
       return std::nullopt;
-    return it->second;
+    return lookupVertexId_nolock(v);
+  }
+
+  std::optional<VertexType> snapshotVertexValue_nolock(const Snapshot &state,
+                                                       VertexId id) const {
+    auto saved = state.vertices.find(id);
+    if (saved != state.vertices.end())
+      return saved->second;
+    if (!state.detached) {
+      auto it = _vertex_data.find(id);
+      if (it != _vertex_data.end())
+        return vertexValue_nolock(it->second);
+    }
+    return std::nullopt;
+  }
+
+  // Row id as the snapshot saw it, as a (data, size) view valid while the
+  // reader lock is held.
+  std::pair<const Neighbor *, size_t>
+  snapshotRow_nolock(const Snapshot &state, VertexId id) const {
+    auto saved = state.rows.find(id);
+    if (saved != state.rows.end()) {
+      if (!saved->second)
+        return {nullptr, 0};
+      return {saved->second->data(), saved->second->size()};
+    }
+    if (!state.detached) {
+      auto it = _adj.find(id);
+      if (it != _adj.end())
+        return {it->second.data(), it->second.size()};
+    }
+    return {nullptr, 0};
+  }
+
+  /**
+   * Calls fn(id, value) for every vertex of the snapshot, with the reader
+   * lock held around each chunk of SNAPSHOT_SCAN_CHUNK vertices only.
+   *
+   * Candidates are the live ids plus every saved id, collected in one pass.
+   * Vertices created after the snapshot resolve to "absent" through their
+   * saved pre-image, so racing writers cannot add entries to the scan.
+   */
+  static constexpr size_t SNAPSHOT_SCAN_CHUNK = 256;
+
+  template <typename Fn>
+  void forEachSnapshotVertex(const Snapshot &state, Fn &&fn) const {
+    std::vector<VertexId> candidates;
+    {
+      std::shared_lock<ReadMostlyMutex> lock(_mtx);
+      candidates.reserve(state.vertices.size() +
+                         (state.detached ? 0 : _vertex_data.size()));
+      for (const auto &kv : state.vertices)
+        candidates.push_back(kv.first);
+      if (!state.detached) {
+        for (const auto &kv : _vertex_data) {
+          if (!state.vertices.count(kv.first))
+            candidates.push_back(kv.first);
+        }
+      }
+    }
+    std::sort(candidates.begin(), candidates.end());
+    for (size_t lo = 0; lo < candidates.size(); lo += SNAPSHOT_SCAN_CHUNK) {
+      size_t hi = std::min(candidates.size(), lo + SNAPSHOT_SCAN_CHUNK);
+      std::shared_lock<ReadMostlyMutex> lock(_mtx);
+      for (size_t i = lo; i < hi; ++i) {
+        if (auto value = snapshotVertexValue_nolock(state, candidates[i]))
+          fn(candidates[i], std::move(*value));
+      }
+    }
+  }
+
+  bool rowHasEdge_nolock(CinderPeak::VertexId from, CinderPeak::VertexId to,
+                         const EdgeType &weight, bool matchWeight) const {
+    for (const auto &p : _adj.at(from)) {
+      if (p.first == to && (!matchWeight || p.second == weight))
+        return true;
+    }
+    return false;
+  }
+
+  EdgeType *findEdge_nolock(CinderPeak::VertexId from,
+                            CinderPeak::VertexId to) {
+    for (auto &p : _adj.at(from)) {
+      if (p.first == to)
+        return &p.second;
+    }
+    return nullptr;
+  }
+
+  std::optional<EdgeType> eraseEdge_nolock(CinderPeak::VertexId from,
+                                           CinderPeak::VertexId to) {
+    auto &neighbors = _adj.at(from);
+    auto it = std::find_if(neighbors.begin(), neighbors.end(),
+                           [&](const auto &p) { return p.first == to; });
+    if (it == neighbors.end())
+      return std::nullopt;
+    preserveRow_nolock(from);
+    EdgeType weight = it->second;
+    neighbors.erase(it);
+    return weight;
+  }
+
+  CinderPeak::VertexId allocateId_nolock() {
+    if (_free_ids.empty())
+      return _next_vertex_id.fetch_add(1, std::memory_order_relaxed);
+    CinderPeak::VertexId id = _free_ids.back();
+    _free_ids.pop_back();
+    return id;
+  }
+
+  PeakStatus addVertex_nolock(const VertexType &v) {
+    if (_vertex_lookup.contains(v)) {
+      if constexpr (CinderPeak::Traits::is_primitive_or_string_v<VertexType>) {
+        runtime.log(LogLevel::WARNING,
+                    "Failed to add Vertex: Vertex Already Exists. " +
+                        vertexStr(v));
+        return PeakStatus::VertexAlreadyExists(
+            "Primitive Vertex Already Exists");
+      } else {
+        runtime.log(LogLevel::WARNING,
+                    "Failed to add Non Primitive Vertex: Non Primitive "
+                    "Vertex Already Exists. " +
+                        vertexStr(v));
+        return PeakStatus::VertexAlreadyExists(
+            "Non Primitive Vertex Already Exists");
+      }
+    }
+
+    VertexId assignedId = allocateId_nolock();
+    preserveVertex_nolock(assignedId, v);
+    _vertex_data.try_emplace(assignedId, _vertex_lookup.insert(v, assignedId));
+    _adj.try_emplace(assignedId);
+    return PeakStatus::OK();
+  }
+
+  PeakStatus removeVertex_nolock(const VertexType &v) {
+    auto idOpt = _vertex_lookup.find(v);
+    if (!idOpt)
+      return PeakStatus::VertexNotFound();
+
+    VertexId id = *idOpt;
+    auto pointsAtId = [&](const std::pair<VertexId, EdgeType> &edge) {
+      return edge.first == id;
+    };
+
+    preserveVertex_nolock(id, v);
+    _adj.erase(id);
+
+    for (auto &pair : _adj) {
+      auto &neighbors = pair.second;
+      auto first = std::find_if(neighbors.begin(), neighbors.end(), pointsAtId);
+      if (first == neighbors.end())
+        continue;
+      preserveRow_nolock(pair.first);
+      neighbors.erase(std::remove_if(first, neighbors.end(), pointsAtId),
+                      neighbors.end());
+    }
+
+    _vertex_lookup.erase(_vertex_data.at(id));
+    _vertex_data.erase(id);
+    _free_ids.push_back(id);
+    return PeakStatus::OK();
+  }
+
+  PeakStatus addEdgeChecked_nolock(const VertexType &src,
+                                   const VertexType &dest,
+                                   const EdgeType &weight,
+                                   const EdgeInsertRules &rules) {
+    auto srcOpt = _vertex_lookup.find(src);
+    auto destOpt = _vertex_lookup.find(dest);
+    if (!srcOpt || !destOpt)
+      return PeakStatus::VertexNotFound(
+          "Source or destination vertex missing.");
+
+    VertexId srcId = *srcOpt;
+    VertexId destId = *destOpt;
+    if (srcId == destId)
+      return PeakStatus::InvalidArgument("Self loops are not allowed.");
+
+    if (rowHasEdge_nolock(srcId, destId, weight, rules.weighted) ||
+        (!rules.directed &&
+         rowHasEdge_nolock(destId, srcId, weight, rules.weighted))) {
+      return PeakStatus::EdgeAlreadyExists("Edge already exists.");
+    }
+
+    preserveRow_nolock(srcId);
+    _adj[srcId].emplace_back(destId, weight);
+    return PeakStatus::OK();
+  }
+
+  PeakStatus addEdgePair_nolock(const VertexType &src, const VertexType &dest,
+                                const EdgeType &weight,
+                                const EdgeInsertRules &rules) {
+    auto srcOpt = _vertex_lookup.find(src);
+    auto destOpt = _vertex_lookup.find(dest);
+    if (!srcOpt || !destOpt)
+      return PeakStatus::VertexNotFound(
+          "Source or destination vertex missing.");
+
+    VertexId srcId = *srcOpt;
+    VertexId destId = *destOpt;
+    if (srcId == destId)
+      return PeakStatus::InvalidArgument("Self loops are not allowed.");
+
+    if (rowHasEdge_nolock(srcId, destId, weight, rules.weighted) ||
+        rowHasEdge_nolock(destId, srcId, weight, rules.weighted)) {
+      return PeakStatus::EdgeAlreadyExists("Edge already exists.");
+    }
+
+    preserveRow_nolock(srcId);
+    preserveRow_nolock(destId);
+    // Reserve first so the second append cannot fail after the first.
+    // Capacity doubles like emplace_back() would, so hub rows stay
+    // amortized O(1) per insert.
+    auto reserveOneMore = [](NeighborList &row) {
+      if (row.size() == row.capacity())
+        row.reserve(std::max(row.size() + 1, 2 * row.capacity()));
+    };
+    auto &forward = _adj.at(srcId);
+    auto &reverse = _adj.at(destId);
+    reserveOneMore(forward);
+    reserveOneMore(reverse);
+    forward.emplace_back(destId, weight);
+    reverse.emplace_back(srcId, weight);
+    return PeakStatus::OK();
+  }
+
+  std::pair<EdgeType, PeakStatus> removeEdge_nolock(const VertexType &src,
+                                                    const VertexType &dest,
+                                                    bool bothDirections) {
+    auto srcOpt = _vertex_lookup.find(src);
+    auto destOpt = _vertex_lookup.find(dest);
+    if (!srcOpt || !destOpt)
+      return std::make_pair(EdgeType(), PeakStatus::VertexNotFound());
+
+    auto weight = eraseEdge_nolock(*srcOpt, *destOpt);
+    if (!weight) {
+      runtime.log(LogLevel::WARNING, "Edge not found.");
+      return std::make_pair(EdgeType(), PeakStatus::EdgeNotFound());
+    }
+    if (bothDirections)
+      (void)eraseEdge_nolock(*destOpt, *srcOpt);
+    return std::make_pair(*weight, PeakStatus::OK());
+  }
+
+  PeakStatus updateEdge_nolock(const VertexType &src, const VertexType &dest,
+                               const EdgeType &newWeight,
+                               bool bothDirections) {
+    auto srcOpt = _vertex_lookup.find(src);
+    auto destOpt = _vertex_lookup.find(dest);
+    if (!srcOpt || !destOpt) {
+      runtime.log(LogLevel::WARNING, "Vertex not found.");
+      return PeakStatus::VertexNotFound();
+    }
+
+    EdgeType *forward = findEdge_nolock(*srcOpt, *destOpt);
+    if (!forward) {
+      runtime.log(LogLevel::INFO, "Edge Not Found.");
+      return PeakStatus::EdgeNotFound();
+    }
+    preserveRow_nolock(*srcOpt);
+    *forward = newWeight;
+    if (bothDirections) {
+      if (EdgeType *reverse = findEdge_nolock(*destOpt, *srcOpt)) {
+        preserveRow_nolock(*destOpt);
+        *reverse = newWeight;
+      }
+    }
+    return PeakStatus::OK();
   }
 
   std::optional<CinderPeak::VertexId>
@@ -51,7 +430,11 @@ private:
   }
 
 public:
-  AdjacencyList(const GraphRuntime &rtime) : runtime{rtime} {
+  AdjacencyList(
+      const GraphRuntime &rtime,
+      std::pmr::memory_resource *resource = std::pmr::get_default_resource())
+      : _adj(resource), _vertex_data(resource), _vertex_lookup(resource),
+        _free_ids(resource), runtime{rtime} {
     _adj.reserve(1024);
     _vertex_data.reserve(1024);
     _vertex_lookup.reserve(1024);
@@ -60,55 +443,25 @@ public:
   [[nodiscard]] const PeakStatus impl_addVertex(const VertexType &v) override {
     runtime.log(LogLevel::DEBUG,
                 "Executing impl_addVertex for " + vertexStr(v));
-    VertexId assignedId = 0;
-    {
-      std::unique_lock<std::shared_mutex> lock(_mtx);
-
-      if (auto it = _vertex_lookup.find(v); it != _vertex_lookup.end()) {
-        if constexpr (CinderPeak::Traits::is_primitive_or_string_v<
-                          VertexType>) {
-          runtime.log(LogLevel::WARNING,
-                      "Failed to add Vertex: Vertex Already Exists. " +
-                          vertexStr(v));
-          return PeakStatus::VertexAlreadyExists(
-              "Primitive Vertex Already Exists");
-        } else {
-          runtime.log(LogLevel::WARNING,
-                      "Failed to add Non Primitive Vertex: Non Primitive "
-                      "Vertex Already Exists. " +
-                          vertexStr(v));
-          return PeakStatus::VertexAlreadyExists(
-              "Non Primitive Vertex Already Exists");
-        }
-      }
-
-      assignedId = _next_vertex_id.fetch_add(1, std::memory_order_relaxed);
-
-      _vertex_lookup.try_emplace(v, assignedId);
-      _vertex_data.try_emplace(assignedId, v);
-      _adj.try_emplace(assignedId);
-    }
-
-    // perform string construction and logging outside of the lock to avoid
-    // blocking critical sections
-    return PeakStatus::OK();
+    std::unique_lock<ReadMostlyMutex> lock(_mtx);
+    return addVertex_nolock(v);
   }
 
   [[nodiscard]] const PeakStatus
   impl_addVertices(const std::vector<VertexType> &vertices) {
     runtime.log(LogLevel::DEBUG, "Executing impl_addVertices");
-    std::unique_lock<std::shared_mutex> lock(_mtx);
+    std::unique_lock<ReadMostlyMutex> lock(_mtx);
     PeakStatus final_status = PeakStatus::OK();
 
     for (const auto &v : vertices) {
-      if (_vertex_lookup.find(v) != _vertex_lookup.end()) {
+      if (_vertex_lookup.contains(v)) {
         final_status = PeakStatus::VertexAlreadyExists();
         runtime.log(LogLevel::WARNING, "Vertex already Exists.");
         continue;
       }
-      VertexId id = _next_vertex_id.fetch_add(1, std::memory_order_relaxed);
-      _vertex_lookup.try_emplace(v, id);
-      _vertex_data.try_emplace(id, v);
+      VertexId id = allocateId_nolock();
+      preserveVertex_nolock(id, v);
+      _vertex_data.try_emplace(id, _vertex_lookup.insert(v, id));
       _adj.try_emplace(id);
     }
     runtime.log(LogLevel::INFO, "Vertex Added successfully.");
@@ -121,23 +474,24 @@ public:
                const EdgeType &weight = EdgeType()) override {
     runtime.log(LogLevel::DEBUG, "Executing impl_addEdge for " +
                                      weightedEdgeStr(src, dest, weight));
-    std::unique_lock<std::shared_mutex> lock(_mtx);
+    std::unique_lock<ReadMostlyMutex> lock(_mtx);
 
-    auto srcIt = _vertex_lookup.find(src);
-    if (srcIt == _vertex_lookup.end()) {
+    auto srcOpt = _vertex_lookup.find(src);
+    if (!srcOpt) {
       return PeakStatus::VertexNotFound();
     }
 
-    auto destIt = _vertex_lookup.find(dest);
-    if (destIt == _vertex_lookup.end()) {
+    auto destOpt = _vertex_lookup.find(dest);
+    if (!destOpt) {
       runtime.log(LogLevel::WARNING, "Vertex not found.");
       return PeakStatus::VertexNotFound();
     }
 
-    VertexId srcId = srcIt->second;
-    VertexId destId = destIt->second;
+    VertexId srcId = *srcOpt;
+    VertexId destId = *destOpt;
 
     // Append neighbor.
+    preserveRow_nolock(srcId);
     auto &neighbors = _adj[srcId];
     neighbors.emplace_back(destId, weight);
 
@@ -146,6 +500,17 @@ public:
     return PeakStatus::OK();
   }
 
+  [[nodiscard]] const PeakStatus
+  impl_addEdgeChecked(const VertexType &src, const VertexType &dest,
+                      const EdgeType &weight,
+                      const EdgeInsertRules &rules) override {
+    if (runtime.isLoggingEnabled())
+      runtime.log(LogLevel::DEBUG, "Executing impl_addEdgeChecked for " +
+                                       weightedEdgeStr(src, dest, weight));
+    std::unique_lock<ReadMostlyMutex> lock(_mtx);
+    return addEdgeChecked_nolock(src, dest, weight, rules);
+  }
+
   template <typename EdgeContainer>
   [[nodiscard]] const PeakStatus impl_addEdges(const EdgeContainer &edges) {
     runtime.log(LogLevel::DEBUG, "Executing impl_addEdges");
@@ -153,7 +518,7 @@ public:
     PeakStatus overall = PeakStatus::OK();
 
     {
-      std::unique_lock<std::shared_mutex> lock(_mtx);
+      std::unique_lock<ReadMostlyMutex> lock(_mtx);
 
       for (const auto &edge : edges) {
         VertexType src;
@@ -175,22 +540,23 @@ public:
           continue;
         }
 
-        auto srcIt = _vertex_lookup.find(src);
-        if (srcIt == _vertex_lookup.end()) {
+        auto srcOpt = _vertex_lookup.find(src);
+        if (!srcOpt) {
           warnings.push_back("The vertex does not exist (src)");
           overall = PeakStatus::VertexNotFound();
           continue;
         }
-        auto destIt = _vertex_lookup.find(dest);
-        if (destIt == _vertex_lookup.end()) {
+        auto destOpt = _vertex_lookup.find(dest);
+        if (!destOpt) {
           warnings.push_back("The vertex does not exist (dest)");
           overall = PeakStatus::VertexNotFound();
           continue;
         }
 
-        VertexId srcId = srcIt->second;
-        VertexId destId = destIt->second;
+        VertexId srcId = *srcOpt;
+        VertexId destId = *destOpt;
 
+        preserveRow_nolock(srcId);
         _adj[srcId].emplace_back(destId, weight);
       }
     }
@@ -203,33 +569,12 @@ public:
   impl_removeEdge(const VertexType &src, const VertexType &dest) override {
     runtime.log(LogLevel::DEBUG,
                 "Executing impl_removeEdge for " + edgeStr(src, dest));
-    std::unique_lock<std::shared_mutex> lock(_mtx);
-    EdgeType retWeight = EdgeType();
-
-    auto srcIt = _vertex_lookup.find(src);
-    if (srcIt == _vertex_lookup.end())
-      return std::make_pair(retWeight, PeakStatus::VertexNotFound());
-    auto destIt = _vertex_lookup.find(dest);
-    if (destIt == _vertex_lookup.end())
-      return std::make_pair(retWeight, PeakStatus::VertexNotFound());
-
-    VertexId srcId = srcIt->second;
-    VertexId destId = destIt->second;
-
-    auto &neighbors = _adj[srcId];
-    auto it = std::find_if(neighbors.begin(), neighbors.end(),
-                           [&](const auto &p) { return p.first == destId; });
-
-    if (it == neighbors.end()) {
-      runtime.log(LogLevel::WARNING, "Edge not found.");
-      return std::make_pair(retWeight, PeakStatus::EdgeNotFound());
-    }
-
-    retWeight = it->second;
-    neighbors.erase(it);
-    runtime.log(LogLevel::INFO, "Edge successfully removed between vertices.");
-
-    return std::make_pair(retWeight, PeakStatus::OK());
+    std::unique_lock<ReadMostlyMutex> lock(_mtx);
+    auto result = removeEdge_nolock(src, dest, false);
+    if (result.second.isOK())
+      runtime.log(LogLevel::INFO,
+                  "Edge successfully removed between vertices.");
+    return result;
   }
 
   [[nodiscard]] const PeakStatus
@@ -237,58 +582,66 @@ public:
                   const EdgeType &newWeight) override {
     runtime.log(LogLevel::DEBUG, "Executing impl_updateEdge for " +
                                      weightedEdgeStr(src, dest, newWeight));
-    std::unique_lock<std::shared_mutex> lock(_mtx);
+    std::unique_lock<ReadMostlyMutex> lock(_mtx);
+    return updateEdge_nolock(src, dest, newWeight, false);
+  }
 
-    auto srcIt = _vertex_lookup.find(src);
-    if (srcIt == _vertex_lookup.end()) {
-      runtime.log(LogLevel::WARNING, "Vertex not found.");
-      return PeakStatus::VertexNotFound();
-    }
-    auto destIt = _vertex_lookup.find(dest);
-    if (destIt == _vertex_lookup.end()) {
-      runtime.log(LogLevel::WARNING, "Vertex not found.");
-      return PeakStatus::VertexNotFound();
-    }
+  [[nodiscard]] const PeakStatus
+  impl_addEdgePair(const VertexType &src, const VertexType &dest,
+                   const EdgeType &weight,
+                   const EdgeInsertRules &rules) override {
+    if (runtime.isLoggingEnabled())
+      runtime.log(LogLevel::DEBUG, "Executing impl_addEdgePair for " +
+                                       weightedEdgeStr(src, dest, weight));
+    std::unique_lock<ReadMostlyMutex> lock(_mtx);
+    return addEdgePair_nolock(src, dest, weight, rules);
+  }
 
-    VertexId srcId = srcIt->second;
-    VertexId destId = destIt->second;
+  [[nodiscard]] const std::pair<EdgeType, PeakStatus>
+  impl_removeEdgePair(const VertexType &src, const VertexType &dest) override {
+    if (runtime.isLoggingEnabled())
+      runtime.log(LogLevel::DEBUG,
+                  "Executing impl_removeEdgePair for " + edgeStr(src, dest));
+    std::unique_lock<ReadMostlyMutex> lock(_mtx);
+    return removeEdge_nolock(src, dest, true);
+  }
 
-    auto &neighbors = _adj[srcId];
-    for (auto &p : neighbors) {
-      if (p.first == destId) {
-        p.second = newWeight;
-        return PeakStatus::OK();
-      }
-    }
-    runtime.log(LogLevel::INFO, "Edge Not Found.");
-    return PeakStatus::EdgeNotFound();
+  [[nodiscard]] const PeakStatus
+  impl_updateEdgePair(const VertexType &src, const VertexType &dest,
+                      const EdgeType &newWeight) override {
+    if (runtime.isLoggingEnabled())
+      runtime.log(LogLevel::DEBUG, "Executing impl_updateEdgePair for " +
+                                       weightedEdgeStr(src, dest, newWeight));
+    std::unique_lock<ReadMostlyMutex> lock(_mtx);
+    return updateEdge_nolock(src, dest, newWeight, true);
   }
 
-  [[nodiscard]] bool impl_hasVertex(const VertexType &v) noexcept override {
-    runtime.log(LogLevel::DEBUG,
-                "Executing impl_hasVertex for " + vertexStr(v));
-    std::shared_lock<std::shared_mutex> lock(_mtx);
+  [[nodiscard]] bool impl_hasVertex(LookupKey v) noexcept override {
+    if (runtime.isLoggingEnabled())
+      runtime.log(LogLevel::DEBUG,
+                  "Executing impl_hasVertex for " + vertexStr(v));
+    std::shared_lock<ReadMostlyMutex> lock(_mtx);
     runtime.log(LogLevel::INFO, "Vertex lookup.");
 
-    return _vertex_lookup.find(v) != _vertex_lookup.end();
+    return _vertex_lookup.contains(v);
   }
 
-  [[nodiscard]] bool
-  impl_doesEdgeExist(const VertexType &src,
-                     const VertexType &dest) noexcept override {
-    runtime.log(LogLevel::DEBUG,
-                "Executing impl_doesEdgeExist for " + edgeStr(src, dest));
-    std::shared_lock<std::shared_mutex> lock(_mtx);
+  [[nodiscard]] bool impl_doesEdgeExist(LookupKey src,
+                                        LookupKey dest) noexcept override {
+    if (runtime.isLoggingEnabled())
+      runtime.log(LogLevel::DEBUG,
+                  "Executing impl_doesEdgeExist for " + edgeStr(src, dest));
+    std::shared_lock<ReadMostlyMutex> lock(_mtx);
 
-    auto srcIt = _vertex_lookup.find(src);
-    if (srcIt == _vertex_lookup.end())
+    auto srcOpt = _vertex_lookup.find(src);
+    if (!srcOpt)
       return false;
-    auto destIt = _vertex_lookup.find(dest);
-    if (destIt == _vertex_lookup.end())
+    auto destOpt = _vertex_lookup.find(dest);
+    if (!destOpt)
       return false;
 
-    VertexId srcId = srcIt->second;
-    VertexId destId = destIt->second;
+    VertexId srcId = *srcOpt;
+    VertexId destId = *destOpt;
 
     const auto &neighbors = _adj.at(srcId);
     for (const auto &p : neighbors) {
@@ -300,21 +653,22 @@ public:
   }
 
   [[nodiscard]] bool
-  impl_doesEdgeExist(const VertexType &src, const VertexType &dest,
+  impl_doesEdgeExist(LookupKey src, LookupKey dest,
                      const EdgeType &weight) noexcept override {
-    runtime.log(LogLevel::DEBUG, "Executing impl_doesEdgeExist for " +
-                                     weightedEdgeStr(src, dest, weight));
-    std::shared_lock<std::shared_mutex> lock(_mtx);
+    if (runtime.isLoggingEnabled())
+      runtime.log(LogLevel::DEBUG, "Executing impl_doesEdgeExist for " +
+                                       weightedEdgeStr(src, dest, weight));
+    std::shared_lock<ReadMostlyMutex> lock(_mtx);
 
-    auto srcIt = _vertex_lookup.find(src);
-    if (srcIt == _vertex_lookup.end())
+    auto srcOpt = _vertex_lookup.find(src);
+    if (!srcOpt)
       return false;
-    auto destIt = _vertex_lookup.find(dest);
-    if (destIt == _vertex_lookup.end())
+    auto destOpt = _vertex_lookup.find(dest);
+    if (!destOpt)
       return false;
 
-    VertexId srcId = srcIt->second;
-    VertexId destId = destIt->second;
+    VertexId srcId = *srcOpt;
+    VertexId destId = *destOpt;
 
     const auto &neighbors = _adj.at(srcId);
     for (const auto &p : neighbors) {
@@ -329,20 +683,21 @@ public:
   }
 
   [[nodiscard]] const std::pair<EdgeType, PeakStatus>
-  impl_getEdge(const VertexType &src, const VertexType &dest) override {
-    runtime.log(LogLevel::DEBUG,
-                "Executing impl_getEdge for " + edgeStr(src, dest));
-    std::shared_lock<std::shared_mutex> lock(_mtx);
-
-    auto srcIt = _vertex_lookup.find(src);
-    if (srcIt == _vertex_lookup.end())
+  impl_getEdge(LookupKey src, LookupKey dest) override {
+    if (runtime.isLoggingEnabled())
+      runtime.log(LogLevel::DEBUG,
+                  "Executing impl_getEdge for " + edgeStr(src, dest));
+    std::shared_lock<ReadMostlyMutex> lock(_mtx);
+
+    auto srcOpt = _vertex_lookup.find(src);
+    if (!srcOpt)
       return std::make_pair(EdgeType(), PeakStatus::VertexNotFound());
-    auto destIt = _vertex_lookup.find(dest);
-    if (destIt == _vertex_lookup.end())
+    auto destOpt = _vertex_lookup.find(dest);
+    if (!destOpt)
       return std::make_pair(EdgeType(), PeakStatus::VertexNotFound());
 
-    VertexId srcId = srcIt->second;
-    VertexId destId = destIt->second;
+    VertexId srcId = *srcOpt;
+    VertexId destId = *destOpt;
 
     const auto &neighbors = _adj.at(srcId);
     for (const auto &p : neighbors) {
@@ -354,33 +709,34 @@ public:
   }
 
   const std::pair<std::vector<std::pair<VertexType, EdgeType>>, PeakStatus>
-  impl_getNeighbors(const VertexType &vertex) const {
-    runtime.log(LogLevel::DEBUG,
-                "Executing impl_getNeighbors for " + vertexStr(vertex));
+  impl_getNeighbors(LookupKey vertex) const {
+    if (runtime.isLoggingEnabled())
+      runtime.log(LogLevel::DEBUG,
+                  "Executing impl_getNeighbors for " + vertexStr(vertex));
     // data copied under lock
     std::vector<std::pair<VertexId, EdgeType>> neighbor_ids;
     std::unordered_map<VertexId, VertexType> vertex_data_snapshot;
 
     {
-      std::shared_lock<std::shared_mutex> lock(_mtx);
+      std::shared_lock<ReadMostlyMutex> lock(_mtx);
 
-      auto it = _vertex_lookup.find(vertex);
-      if (it == _vertex_lookup.end()) {
+      auto idOpt = _vertex_lookup.find(vertex);
+      if (!idOpt) {
         return std::make_pair(std::vector<std::pair<VertexType, EdgeType>>{},
                               PeakStatus::VertexNotFound());
       }
 
-      VertexId id = it->second;
-      const auto &neighbors = _adj.at(id);
+      const auto &neighbors = _adj.at(*idOpt);
 
       // copy neighbor list
-      neighbor_ids = neighbors;
+      neighbor_ids.assign(neighbors.begin(), neighbors.end());
 
       // copy relevant vertex data for neighbors
       for (const auto &p : neighbor_ids) {
         auto vdataIt = _vertex_data.find(p.first);
         if (vdataIt != _vertex_data.end()) {
-          vertex_data_snapshot.try_emplace(vdataIt->first, vdataIt->second);
+          vertex_data_snapshot.try_emplace(vdataIt->first,
+                                           vertexValue_nolock(vdataIt->second));
         }
       }
     }
@@ -402,39 +758,60 @@ public:
   impl_removeVertex(const VertexType &v) override {
     runtime.log(LogLevel::DEBUG,
                 "Executing impl_removeVertex for " + vertexStr(v));
-    std::unique_lock<std::shared_mutex> lock(_mtx);
-
-    auto it = _vertex_lookup.find(v);
-    if (it == _vertex_lookup.end())
-      return PeakStatus::VertexNotFound();
-
-    VertexId id = it->second;
-
-    _adj.erase(id);
+    std::unique_lock<ReadMostlyMutex> lock(_mtx);
+    PeakStatus status = removeVertex_nolock(v);
+    if (status.isOK())
+      runtime.log(LogLevel::INFO, "Vertex successfully removed.");
+    return status;
+  }
 
-    for (auto &pair : _adj) {
-      auto &neighbors = pair.second;
-      neighbors.erase(
-          std::remove_if(neighbors.begin(), neighbors.end(),
-                         [&](const std::pair<VertexId, EdgeType> &edge) {
-                           return edge.first == id;
-                         }),
-          neighbors.end());
+  [[nodiscard]] BatchResult
+  impl_applyBatch(const WriteBatch<VertexType, EdgeType> &batch,
+                  const EdgeInsertRules &rules) override {
+    runtime.log(LogLevel::DEBUG, "Executing impl_applyBatch");
+    using Op = typename WriteBatch<VertexType, EdgeType>::Op;
+    const size_t directions = rules.directed ? 1 : 2;
+    BatchResult result(batch.size());
+
+    std::unique_lock<ReadMostlyMutex> lock(_mtx);
+    const auto &ops = batch.ops();
+    for (size_t i = 0; i < ops.size(); ++i) {
+      const Op &op = ops[i];
+      PeakStatus status = PeakStatus::OK();
+      switch (op.kind) {
+      case BatchOpKind::AddVertex:
+        status = addVertex_nolock(op.src);
+        break;
+      case BatchOpKind::RemoveVertex:
+        status = removeVertex_nolock(op.src);
+        break;
+      case BatchOpKind::AddEdge: {
+        const EdgeType &stored = rules.weighted ? op.weight : EdgeType();
+        status = rules.directed
+                     ? addEdgeChecked_nolock(op.src, op.dest, stored, rules)
+                     : addEdgePair_nolock(op.src, op.dest, stored, rules);
+        break;
+      }
+      case BatchOpKind::RemoveEdge:
+        status = removeEdge_nolock(op.src, op.dest, !rules.directed).second;
+        break;
+      case BatchOpKind::UpdateEdge:
+        status = updateEdge_nolock(op.src, op.dest, op.weight, !rules.directed);
+        break;
+      }
+      result.record(i, op.kind, status, directions);
     }
-
-    _vertex_lookup.erase(it);
-    _vertex_data.erase(id);
-    runtime.log(LogLevel::INFO, "Vertex successfully removed.");
-
-    return PeakStatus::OK();
+    return result;
   }
 
   [[nodiscard]] const PeakStatus impl_clearVertices() override {
     runtime.log(LogLevel::DEBUG, "Executing impl_clearVertices");
-    std::unique_lock<std::shared_mutex> lock(_mtx);
+    std::unique_lock<ReadMostlyMutex> lock(_mtx);
+    detachSnapshots_nolock();
     _adj.clear();
     _vertex_lookup.clear();
     _vertex_data.clear();
+    _free_ids.clear();
     _next_vertex_id.store(1, std::memory_order_relaxed);
     runtime.log(LogLevel::INFO, "Vertex successfully Cleared.");
 
@@ -443,7 +820,8 @@ public:
 
   [[nodiscard]] const PeakStatus impl_clearEdges() override {
     runtime.log(LogLevel::DEBUG, "Executing impl_clearEdges");
-    std::unique_lock<std::shared_mutex> lock(_mtx);
+    std::unique_lock<ReadMostlyMutex> lock(_mtx);
+    detachSnapshots_nolock();
     for (auto &pair : _adj) {
       pair.second.clear();
     }
@@ -452,9 +830,238 @@ public:
     return PeakStatus::OK();
   }
 
-  const std::unordered_map<
-      CinderPeak::VertexId,
-      std::vector<std::pair<CinderPeak::VertexId, EdgeType>>> &
+  /**
+   * @brief Renumbers live vertices densely as 1..numVertices.
+   *
+   * Ids keep their relative order. Adjacency rows and vertex keys are
+   * rewritten in a single pass, and the free list is dropped. Any VertexId
+   * obtained earlier (e.g. via getInternalAdjacency()) is invalidated.
+   */
+  [[nodiscard]] const PeakStatus compactIds() {
+    runtime.log(LogLevel::DEBUG, "Executing compactIds");
+    std::unique_lock<ReadMostlyMutex> lock(_mtx);
+    detachSnapshots_nolock();
+
+    std::vector<VertexId> live;
+    live.reserve(_vertex_data.size());
+    for (const auto &kv : _vertex_data)
+      live.push_back(kv.first);
+    std::sort(live.begin(), live.end());
+
+    // Old ids are bounded by _next_vertex_id, so a flat table suffices.
+    std::vector<VertexId> remap(
+        idCast<size_t>(_next_vertex_id.load(std::memory_order_relaxed)), 0);
+    for (size_t i = 0; i < live.size(); ++i)
+      remap[idCast<size_t>(live[i])] = idCast<VertexId>(i + 1);
+
+    // The index is rebuilt from the live vertices so names of removed
+    // vertices leave the string arena.
+    decltype(_adj) new_adj(_adj.get_allocator());
+    decltype(_vertex_data) new_vertex_data(_vertex_data.get_allocator());
+    decltype(_vertex_lookup) new_lookup(_adj.get_allocator().resource());
+    new_adj.reserve(live.size());
+    new_vertex_data.reserve(live.size());
+    new_lookup.reserve(live.size());
+    for (VertexId old_id : live) {
+      VertexId new_id = remap[idCast<size_t>(old_id)];
+      auto &row = _adj[old_id];
+      for (auto &edge : row)
+        edge.first = remap[idCast<size_t>(edge.first)];
+      new_adj.emplace(new_id, std::move(row));
+
+      const VertexKey &key = _vertex_data.at(old_id);
+      new_vertex_data.emplace(
+          new_id, new_lookup.insert(_vertex_lookup.value(key), new_id));
+    }
+
+    _adj = std::move(new_adj);
+    _vertex_data = std::move(new_vertex_data);
+    _vertex_lookup = std::move(new_lookup);
+    _free_ids.clear();
+    _next_vertex_id.store(idCast<VertexId>(live.size() + 1),
+                          std::memory_order_relaxed);
+    runtime.log(LogLevel::INFO, "Vertex ids compacted.");
+
+    return PeakStatus::OK();
+  }
+
+  /**
+   * @brief Fills an empty storage straight from a prebuilt edge set.
+   *
+   * Skips per-edge validation: the set is already interned and
+   * deduplicated. Rows are sized from the degree counts first, so each row
+   * allocates once. Fails with AlreadyExists if any vertex is present.
+   */
+  [[nodiscard]] const PeakStatus
+  bulkLoad(const BulkEdgeSet<VertexType, EdgeType> &set) {
+    runtime.log(LogLevel::DEBUG, "Executing bulkLoad");
+    std::unique_lock<ReadMostlyMutex> lock(_mtx);
+    if (!_vertex_data.empty())
+      return PeakStatus::AlreadyExists("Bulk load needs an empty graph.");
+    detachSnapshots_nolock();
+
+    const size_t n = set.vertices.size();
+    std::vector<size_t> degree(n + 1, 0);
+    for (const auto &edge : set.edges) {
+      ++degree[edge.src];
+      if (set.undirected)
+        ++degree[edge.dest];
+    }
+
+    _adj.reserve(n);
+    _vertex_data.reserve(n);
+    _vertex_lookup.reserve(n);
+    // Node references stay valid across rehashes, so rows can be cached.
+    std::vector<NeighborList *> rows(n + 1, nullptr);
+    for (size_t i = 0; i < n; ++i) {
+      VertexId id = i + 1;
+      _vertex_data.try_emplace(id, _vertex_lookup.insert(set.vertices[i], id));
+      rows[id] = &_adj.try_emplace(id).first->second;
+      rows[id]->reserve(degree[id]);
+    }
+    for (const auto &edge : set.edges) {
+      rows[edge.src]->emplace_back(edge.dest, edge.weight);
+      if (set.undirected)
+        rows[edge.dest]->emplace_back(edge.src, edge.weight);
+    }
+
+    _free_ids.clear();
+    _next_vertex_id.store(n + 1, std::memory_order_relaxed);
+    runtime.log(LogLevel::INFO, "Bulk load completed.");
+    return PeakStatus::OK();
+  }
+
+  /**
+   * @brief Copies the graph into a BulkEdgeSet under one reader lock.
+   *
+   * Vertices are renumbered densely in id order. Every stored direction is
+   * listed (the set is never marked undirected), grouped by source.
+   */
+  BulkEdgeSet<VertexType, EdgeType> exportEdgeSet() const {
+    runtime.log(LogLevel::DEBUG, "Executing exportEdgeSet");
+    std::shared_lock<ReadMostlyMutex> lock(_mtx);
+    BulkEdgeSet<VertexType, EdgeType> set;
+
+    std::vector<VertexId> live;
+    live.reserve(_vertex_data.size());
+    for (const auto &kv : _vertex_data)
+      live.push_back(kv.first);
+    std::sort(live.begin(), live.end());
+
+    std::vector<VertexId> remap(_next_vertex_id.load(std::memory_order_relaxed),
+                                0);
+    set.vertices.reserve(live.size());
+    for (size_t i = 0; i < live.size(); ++i) {
+      remap[live[i]] = i + 1;
+      set.vertices.push_back(vertexValue_nolock(_vertex_data.at(live[i])));
+    }
+    for (VertexId id : live) {
+      for (const auto &edge : _adj.at(id))
+        set.edges.push_back({remap[id], remap[edge.first], edge.second});
+    }
+    return set;
+  }
+
+  /**
+   * @brief Opens a snapshot of the current graph state.
+   *
+   * O(V) under the writer lock (to count edges); nothing is copied. From
+   * then on each writer saves what it is about to change, once per item,
+   * so later writes do not show through. Read the snapshot with the
+   * snapshot* methods below; it is reclaimed when the last shared_ptr to it
+   * is released.
+   */
+  std::shared_ptr<const Snapshot> openSnapshot() {
+    runtime.log(LogLevel::DEBUG, "Executing openSnapshot");
+    std::unique_lock<ReadMostlyMutex> lock(_mtx);
+    auto state = std::make_shared<Snapshot>();
+    state->sequence = ++_snapshot_sequence;
+    state->num_vertices = _vertex_data.size();
+    for (const auto &kv : _adj)
+      state->num_edges += kv.second.size();
+    forEachSnapshot_nolock([](Snapshot &) {}); // prune closed snapshots
+    _snapshots.push_back(state);
+    return state;
+  }
+
+  // Open snapshots still referenced by a handle.
+  size_t openSnapshotCount() const {
+    std::shared_lock<ReadMostlyMutex> lock(_mtx);
+    size_t count = 0;
+    for (const auto &weak : _snapshots)
+      count += weak.expired() ? 0 : 1;
+    return count;
+  }
+
+  // Snapshot reads. Each call holds the reader lock only for its own
+  // duration, so a long scan over a snapshot never holds writers off for
+  // more than one call (or one chunk of a vertices()/edges() scan).
+  bool snapshotHasVertex(const Snapshot &state, LookupKey v) const {
+    std::shared_lock<ReadMostlyMutex> lock(_mtx);
+    return snapshotVertexId_nolock(state, v).has_value();
+  }
+
+  std::pair<EdgeType, PeakStatus>
+  snapshotGetEdge(const Snapshot &state, LookupKey src, LookupKey dest) const {
+    std::shared_lock<ReadMostlyMutex> lock(_mtx);
+    auto srcOpt = snapshotVertexId_nolock(state, src);
+    auto destOpt = snapshotVertexId_nolock(state, dest);
+    if (!srcOpt || !destOpt)
+      return std::make_pair(EdgeType(), PeakStatus::VertexNotFound());
+    auto [data, size] = snapshotRow_nolock(state, *srcOpt);
+    for (size_t i = 0; i < size; ++i) {
+      if (data[i].first == *destOpt)
+        return std::make_pair(data[i].second, PeakStatus::OK());
+    }
+    return std::make_pair(EdgeType(), PeakStatus::EdgeNotFound());
+  }
+
+  std::pair<std::vector<std::pair<VertexType, EdgeType>>, PeakStatus>
+  snapshotGetNeighbors(const Snapshot &state, LookupKey v) const {
+    std::vector<std::pair<VertexType, EdgeType>> result;
+    std::shared_lock<ReadMostlyMutex> lock(_mtx);
+    auto idOpt = snapshotVertexId_nolock(state, v);
+    if (!idOpt)
+      return std::make_pair(result, PeakStatus::VertexNotFound());
+    auto [data, size] = snapshotRow_nolock(state, *idOpt);
+    result.reserve(size);
+    for (size_t i = 0; i < size; ++i) {
+      if (auto dest = snapshotVertexValue_nolock(state, data[i].first))
+        result.emplace_back(std::move(*dest), data[i].second);
+    }
+    return std::make_pair(result, PeakStatus::OK());
+  }
+
+  std::vector<VertexType> snapshotVertices(const Snapshot &state) const {
+    std::vector<VertexType> result;
+    result.reserve(state.num_vertices);
+    forEachSnapshotVertex(state, [&](VertexId, VertexType value) {
+      result.push_back(std::move(value));
+    });
+    return result;
+  }
+
+  std::vector<std::tuple<VertexType, VertexType, EdgeType>>
+  snapshotEdgeList(const Snapshot &state) const {
+    std::vector<std::tuple<VertexType, VertexType, EdgeType>> result;
+    result.reserve(state.num_edges);
+    forEachSnapshotVertex(state, [&](VertexId id, const VertexType &value) {
+      auto [data, size] = snapshotRow_nolock(state, id);
+      for (size_t i = 0; i < size; ++i) {
+        if (auto dest = snapshotVertexValue_nolock(state, data[i].first))
+          result.emplace_back(value, std::move(*dest), data[i].second);
+      }
+    });
+    return result;
+  }
+
+  // Ids released by removeVertex and not yet reused.
+  size_t freeIdCount() const {
+    std::shared_lock<ReadMostlyMutex> lock(_mtx);
+    return _free_ids.size();
+  }
+
+  const std::pmr::unordered_map<CinderPeak::VertexId, NeighborList> &
   getInternalAdjacency() const {
     runtime.log(LogLevel::DEBUG, "Executing getInternalAdjacency");
     return _adj;
@@ -468,7 +1075,7 @@ public:
   std::string impl_toDot(bool isDirected, bool allowParallel = false,
                          const DotConfig &config = DotConfig()) const {
     runtime.log(LogLevel::DEBUG, "Executing impl_toDot");
-    std::shared_lock<std::shared_mutex> lock(_mtx);
+    std::shared_lock<ReadMostlyMutex> lock(_mtx);
     std::stringstream ss;
 
     if (!allowParallel) {
@@ -486,10 +1093,9 @@ public:
     // declare all nodes first (ensures isolated nodes appear)
     for (const auto &kv : _vertex_data) {
       VertexId id = kv.first;
-      const VertexType &v = kv.second;
 
       ss << "  node_" << id << " [label=\"";
-      ss << v;
+      ss << _vertex_lookup.value(kv.second);
       ss << "\"];\n";
     }
 
@@ -515,35 +1121,42 @@ public:
     return ss.str();
   }
 
-  const std::unordered_map<CinderPeak::VertexId, VertexType> &
+  const std::pmr::unordered_map<CinderPeak::VertexId, VertexKey> &
   getVertexDataMap() const {
     runtime.log(LogLevel::DEBUG, "Executing getVertexDataMap");
     return _vertex_data;
   }
 
+  const VertexIndex<VertexType, CinderPeak::VertexId> &
+  getVertexIndex() const {
+    return _vertex_lookup;
+  }
+
   [[nodiscard]] std::vector<VertexType> impl_getVertices() const override {
-    std::shared_lock<std::shared_mutex> lock(_mtx);
+    std::shared_lock<ReadMostlyMutex> lock(_mtx);
     std::vector<VertexType> result;
     result.reserve(_vertex_data.size());
-    for (const auto &[id, vtx] : _vertex_data) {
-      result.push_back(vtx);
+    for (const auto &[id, key] : _vertex_data) {
+      result.push_back(vertexValue_nolock(key));
     }
     return result;
   }
 
   [[nodiscard]] std::vector<std::tuple<VertexType, VertexType, EdgeType>>
   impl_getEdgeList() const override {
-    std::shared_lock<std::shared_mutex> lock(_mtx);
+    std::shared_lock<ReadMostlyMutex> lock(_mtx);
     std::vector<std::tuple<VertexType, VertexType, EdgeType>> result;
     for (const auto &[srcId, neighbors] : _adj) {
       auto srcIt = _vertex_data.find(srcId);
       if (srcIt == _vertex_data.end())
         continue;
+      VertexType srcValue = vertexValue_nolock(srcIt->second);
       for (const auto &[destId, weight] : neighbors) {
         auto destIt = _vertex_data.find(destId);
         if (destIt == _vertex_data.end())
           continue;
-        result.emplace_back(srcIt->second, destIt->second, weight);
+        result.emplace_back(srcValue, vertexValue_nolock(destIt->second),
+                            weight);
       }
     }
     return result;
@@ -3,6 +3,7 @@
 #include "Utils.hpp"
 #include <cstdint>
 #include <string>
+#include <string_view>
 #include <type_traits>
 
 namespace CinderPeak {
@@ -12,6 +13,7 @@ namespace CinderPeak {
  *
  * Uses compile-time if constexpr (C++17) to handle:
  *   - Primitive types, std::string, enums   → std::to_string / direct return
+ *   - std::string_view (string lookup keys) → copied into a std::string
  *   - Unweighted sentinel                   → "Unweighted"
  *   - std::optional<T>                      → recursive dbg(*v) or "nullopt"
  *   - Pointer types                         → recursive dbg(*v) or "null"
@@ -27,8 +29,13 @@ namespace CinderPeak {
  */
 template <typename T> inline std::string dbg(const T &v) {
 
+  // String lookup key
+  if constexpr (std::is_same_v<T, std::string_view>) {
+    return std::string(v);
+  }
+
   // Primitive / string / enum
-  if constexpr (Traits::is_primitive_enum_or_string_v<T>) {
+  else if constexpr (Traits::is_primitive_enum_or_string_v<T>) {
     if constexpr (std::is_same_v<T, std::string>) {
       return v;
     } else if constexpr (std::is_same_v<T, bool>) {
@@ -4,15 +4,20 @@
 #include "GraphRuntime.hpp"
 #include "PeakLogger.hpp"
 #include "StorageEngine/GraphStatistics.hpp"
+#include "StorageEngine/NeighborCache.hpp"
 #include "StorageEngine/Utils.hpp"
+#include "StorageEngine/WriteAheadLog.hpp"
 #include "StorageInterface.hpp"
+#include "StoragePolicy.hpp"
+#include <atomic>
 #include <memory>
+#include <mutex>
 namespace CinderPeak {
 template <typename, typename> class PeakStorageInterface;
 namespace PeakStore {
 
-// Forward declarations
-template <typename VertexType, typename EdgeType> class AdjacencyList;
+// Forward declarations (AdjacencyList's default InlineNeighbors is set in
+// StoragePolicy.hpp)
 template <typename VertexType, typename EdgeType> class HybridCSR_COO;
 
 template <typename VertexType, typename EdgeType> class GraphContext {
@@ -27,6 +32,16 @@ public:
   std::shared_ptr<Algorithms::CinderPeakAlgorithms<VertexType, EdgeType>>
       algorithms = nullptr;
   std::shared_ptr<GraphRuntime> runtime = nullptr;
+  // Set by PeakStore::enableWriteAheadLog; null when the graph is not
+  // logged.
+  std::shared_ptr<WriteAheadLog> wal = nullptr;
+  // Set by PeakStore::enableNeighborCache; null when rows are not cached.
+  std::shared_ptr<NeighborCache<VertexType, EdgeType>> neighbor_cache =
+      nullptr;
+  // Set by every topology event; PeakStore reloads hybrid_storage from the
+  // adjacency list before the next traversal.
+  std::atomic<bool> hybrid_stale{true};
+  std::mutex hybrid_sync_mtx;
   EventHub<VertexType, EdgeType> events;
   inline void log(LogLevel level, const std::string &msg) {
     runtime->log(level, msg);
@@ -1,4 +1,5 @@
 #pragma once
+#include "StorageEngine/ShardedCounter.hpp"
 #include "Utils.hpp"
 #include <atomic>
 #include <bitset>
@@ -20,11 +21,28 @@ namespace PeakStore {
 
 enum class UpdateOp : uint8_t { Add, Remove, Clear };
 
+// Vertex and edge counts read together, e.g. to derive the density.
+struct GraphCounts {
+  size_t vertices = 0;
+  size_t edges = 0;
+
+  // Stored edges over V * (V - 1). Undirected edges are stored twice, so
+  // the same formula holds for both kinds of graph.
+  float density() const {
+    if (vertices <= 1)
+      return 0.0f;
+    return static_cast<float>(edges) /
+           static_cast<float>(vertices * (vertices - 1));
+  }
+};
+
+// Vertex and edge counts are sharded atomics (see ShardedCounter) and never
+// take _mtx; the mutex only guards the graph name. The type flags are set
+// at construction and read without locking.
 class GraphInternalMetadata {
 private:
-  size_t num_vertices;
-  size_t num_edges;
-  float density;
+  ShardedCounter num_vertices;
+  ShardedCounter num_edges;
   const std::string graph_type;
   std::string graph_name;
   bool is_vertex_type_primitive;
@@ -40,9 +58,6 @@ public:
       : graph_type(graphType), is_vertex_type_primitive(vertex_tp_p),
         is_edge_type_primitive(edge_tp_p) {
 
-    num_vertices = 0;
-    num_edges = 0;
-    density = 0.0;
     is_graph_weighted = weighted;
     is_graph_unweighted = unweighted;
     graph_name = CinderPeak::generateDefaultGraphName();
@@ -52,9 +67,8 @@ public:
   GraphInternalMetadata(const GraphInternalMetadata &metadata)
       : graph_type(metadata.graph_type) {
     std::shared_lock<std::shared_mutex> lock(metadata._mtx);
-    num_vertices = metadata.num_vertices;
-    num_edges = metadata.num_edges;
-    density = metadata.density;
+    num_vertices.store(metadata.num_vertices.load());
+    num_edges.store(metadata.num_edges.load());
     is_vertex_type_primitive = metadata.is_vertex_type_primitive;
     is_edge_type_primitive = metadata.is_edge_type_primitive;
     is_graph_weighted = metadata.is_graph_weighted;
@@ -67,9 +81,8 @@ public:
     if (this != &metadata) {
       std::shared_lock<std::shared_mutex> metadata_lock(metadata._mtx);
       std::unique_lock<std::shared_mutex> this_lock(_mtx);
-      num_vertices = metadata.num_vertices;
-      num_edges = metadata.num_edges;
-      density = metadata.density;
+      num_vertices.store(metadata.num_vertices.load());
+      num_edges.store(metadata.num_edges.load());
       is_vertex_type_primitive = metadata.is_vertex_type_primitive;
       is_edge_type_primitive = metadata.is_edge_type_primitive;
       is_graph_weighted = metadata.is_graph_weighted;
@@ -82,74 +95,56 @@ public:
   GraphInternalMetadata(GraphInternalMetadata &&) = delete;
   GraphInternalMetadata &operator=(GraphInternalMetadata &&) = delete;
 
-  bool isGraphWeighted() {
-    std::shared_lock<std::shared_mutex> lock(_mtx);
-    return is_graph_weighted;
-  }
-  bool isGraphUnweighted() {
-    std::shared_lock<std::shared_mutex> lock(_mtx);
-    return is_graph_unweighted;
-  }
+  bool isGraphWeighted() const { return is_graph_weighted; }
+  bool isGraphUnweighted() const { return is_graph_unweighted; }
 
-  size_t numEdges() {
-    std::shared_lock<std::shared_mutex> lock(_mtx);
-    return num_edges;
-  }
-  size_t numVertices() {
-    std::shared_lock<std::shared_mutex> lock(_mtx);
-    return num_vertices;
-  }
-  std::string graphType() {
-    std::shared_lock<std::shared_mutex> lock(_mtx);
-    return graph_type;
-  }
+  size_t numEdges() const { return num_edges.load(); }
+  size_t numVertices() const { return num_vertices.load(); }
+  std::string graphType() const { return graph_type; }
 
-  void updateEdgeCount(const UpdateOp &opt) {
-    std::unique_lock<std::shared_mutex> lock(_mtx);
+  GraphCounts counts() const {
+    return GraphCounts{num_vertices.load(), num_edges.load()};
+  }
 
+  void updateEdgeCount(const UpdateOp &opt, size_t count = 1) {
     if (opt == UpdateOp::Add)
-      num_edges++;
+      num_edges.add(static_cast<int64_t>(count));
     else if (opt == UpdateOp::Remove)
-      num_edges--;
+      num_edges.add(-static_cast<int64_t>(count));
     else if (opt == UpdateOp::Clear)
-      num_edges = 0;
+      num_edges.store(0);
   }
 
   void updateVertexCount(const UpdateOp &opt) {
-    std::unique_lock<std::shared_mutex> lock(_mtx);
-
     if (opt == UpdateOp::Add)
-      num_vertices++;
+      num_vertices.add(1);
     else if (opt == UpdateOp::Remove)
-      num_vertices--;
+      num_vertices.add(-1);
     else if (opt == UpdateOp::Clear)
-      num_vertices = 0;
+      num_vertices.store(0);
   }
 
-  void updateDensity(bool directed) {
-    std::unique_lock<std::shared_mutex> lock(_mtx);
-
-    if (num_vertices <= 1) {
-      density = 0.0f;
-      return;
-    }
-    auto max_edges = static_cast<float>(num_vertices * (num_vertices - 1));
-    // num_edges naturally stores 2E for undirected graphs,
-    // making the math self-correcting
-    density = static_cast<float>(num_edges) / max_edges;
+  // Applies a batch's net vertex and edge changes.
+  void applyCountDelta(size_t verticesAdded, size_t verticesRemoved,
+                       size_t edgesAdded, size_t edgesRemoved) {
+    num_vertices.add(static_cast<int64_t>(verticesAdded) -
+                     static_cast<int64_t>(verticesRemoved));
+    num_edges.add(static_cast<int64_t>(edgesAdded) -
+                  static_cast<int64_t>(edgesRemoved));
   }
 
-  std::string getGraphStatistics(bool directed) {
-    updateDensity(directed);
+  float density() const { return counts().density(); }
 
-    std::shared_lock<std::shared_mutex> lock(_mtx);
+  std::string getGraphStatistics(bool directed) const {
+    (void)directed;
+    GraphCounts snapshot = counts();
 
     std::stringstream ss;
     ss << "=== Graph Statistics ===" << std::endl;
-    ss << "Vertices: " << num_vertices << std::endl;
-    ss << "Edges: " << num_edges << std::endl;
-    ss << "Density: " << std::fixed << std::setprecision(2) << density
-       << std::endl;
+    ss << "Vertices: " << snapshot.vertices << std::endl;
+    ss << "Edges: " << snapshot.edges << std::endl;
+    ss << "Density: " << std::fixed << std::setprecision(2)
+       << snapshot.density() << std::endl;
 
     return ss.str();
   }
@@ -1,10 +1,17 @@
 #pragma once
 #include "../StorageInterface.hpp"
+#include "Algorithms/CSRView.hpp"
+#include "Algorithms/Result/indexed_vertices.hpp"
+#include "Operations/BulkBuild.hpp"
 #include "StorageEngine/GraphContext.hpp"
 #include "Utils.hpp"
+#include "VertexIndex.hpp"
 #include <algorithm>
 #include <atomic>
 #include <iostream>
+#include <memory_resource>
+#include <mutex>
+#include <optional>
 #include <shared_mutex>
 #include <unordered_map>
 #include <unordered_set>
@@ -16,29 +23,97 @@ namespace PeakStore {
 
 template <typename VertexType, typename EdgeType>
 class HybridCSR_COO : public PeakStorageInterface<VertexType, EdgeType> {
+public:
+  using LookupKey = VertexLookupKey<VertexType>;
+
 private:
-  alignas(64) std::vector<size_t> csr_row_offsets;
-  alignas(64) std::vector<size_t> csr_col_vals;
-  alignas(64) std::vector<EdgeType> csr_weights;
+  // Every long-lived buffer below allocates from _resource. Scratch vectors
+  // used while rebuilding stay on the global heap.
+  std::pmr::memory_resource *_resource;
+
+  alignas(64) std::pmr::vector<size_t> csr_row_offsets;
+  alignas(64) std::pmr::vector<size_t> csr_col_vals;
+  alignas(64) std::pmr::vector<EdgeType> csr_weights;
 
-  alignas(64) std::vector<size_t> coo_src;
-  alignas(64) std::vector<size_t> coo_dest;
-  alignas(64) std::vector<EdgeType> coo_weights;
+  alignas(64) std::pmr::vector<size_t> coo_src;
+  alignas(64) std::pmr::vector<size_t> coo_dest;
+  alignas(64) std::pmr::vector<EdgeType> coo_weights;
 
-  std::vector<VertexType> vertex_order;
-  std::unordered_map<VertexType, size_t, VertexHasher<VertexType>>
-      vertex_to_index;
+  // vertex_order holds index keys rather than vertex values, so string
+  // vertices are stored once (in vertex_to_index's interner).
+  using VertexKey = typename VertexIndex<VertexType, size_t>::key_type;
+  std::pmr::vector<VertexKey> vertex_order;
+  VertexIndex<VertexType, size_t> vertex_to_index;
 
   mutable std::shared_mutex _mtx;
   mutable std::atomic<bool> is_built_{false};
   std::atomic<size_t> COO_BUFFER_THRESHOLD_{1024};
-  std::unordered_set<size_t> _tombstoned;
+  std::pmr::unordered_set<size_t> _tombstoned;
+
+  // Bumped by every exclusive lock; the transpose is rebuilt when it lags.
+  size_t _csr_version = 0;
+  mutable std::mutex _transpose_mtx;
+  mutable size_t _transpose_version = SIZE_MAX;
+  mutable std::pmr::vector<size_t> csc_col_offsets;
+  mutable std::pmr::vector<size_t> csc_row_vals;
+
+  // Vertex values by index for algorithm results, versioned like the
+  // transpose and shared by every result taken from one CSR version.
+  mutable std::mutex _vertex_table_mtx;
+  mutable size_t _vertex_table_version = SIZE_MAX;
+  mutable std::shared_ptr<const Algorithms::VertexTable<VertexType>>
+      _vertex_table;
+
+  // Exclusive lock for any change; also retires the cached transpose.
+  std::unique_lock<std::shared_mutex> writeLock() {
+    std::unique_lock<std::shared_mutex> lock(_mtx);
+    ++_csr_version;
+    return lock;
+  }
+
+  // In-edge arrays of the built CSR, by counting sort. Caller holds _mtx
+  // shared; concurrent readers serialize on _transpose_mtx.
+  void buildTranspose_nolock() const {
+    std::lock_guard<std::mutex> guard(_transpose_mtx);
+    if (_transpose_version == _csr_version)
+      return;
+    const size_t n = vertex_order.size();
+    csc_col_offsets.assign(n + 1, 0);
+    csc_row_vals.resize(csr_col_vals.size());
+    for (size_t dest : csr_col_vals)
+      ++csc_col_offsets[dest + 1];
+    for (size_t v = 0; v < n; ++v)
+      csc_col_offsets[v + 1] += csc_col_offsets[v];
+    std::vector<size_t> next(csc_col_offsets.begin(),
+                             csc_col_offsets.end() - 1);
+    for (size_t src = 0; src < n; ++src) {
+      for (size_t e = csr_row_offsets[src]; e < csr_row_offsets[src + 1]; ++e)
+        csc_row_vals[next[csr_col_vals[e]]++] = src;
+    }
+    _transpose_version = _csr_version;
+  }
+
+  // Caller holds _mtx shared. Rebuilt only after the CSR changed; results
+  // still holding an older table keep it alive.
+  std::shared_ptr<const Algorithms::VertexTable<VertexType>>
+  vertexTable_nolock() const {
+    std::lock_guard<std::mutex> guard(_vertex_table_mtx);
+    if (_vertex_table_version != _csr_version) {
+      auto table = std::make_shared<Algorithms::VertexTable<VertexType>>();
+      table->vertices.reserve(vertex_order.size());
+      for (size_t i = 0; i < vertex_order.size(); ++i)
+        table->vertices.push_back(vertexValue(i));
+      _vertex_table = std::move(table);
+      _vertex_table_version = _csr_version;
+    }
+    return _vertex_table;
+  }
 
   void buildStructures() {
     if (is_built_.load(std::memory_order_acquire))
       return;
 
-    std::unique_lock<std::shared_mutex> lock(_mtx);
+    auto lock = writeLock();
 
     if (is_built_.load(std::memory_order_relaxed))
       return;
@@ -63,7 +138,8 @@ private:
     csr_col_vals.resize(csr_row_offsets[num_vertices]);
     csr_weights.resize(csr_row_offsets[num_vertices]);
 
-    std::vector<size_t> insert_offsets = csr_row_offsets;
+    std::vector<size_t> insert_offsets(csr_row_offsets.begin(),
+                                       csr_row_offsets.end());
     std::vector<std::vector<std::pair<size_t, EdgeType>>> temp_rows(
         num_vertices);
     for (size_t i = 0; i < coo_src.size(); ++i) {
@@ -104,7 +180,7 @@ private:
       }
     }
 
-    std::vector<size_t> new_row_offsets(num_vertices + 1, 0);
+    std::pmr::vector<size_t> new_row_offsets(num_vertices + 1, 0, _resource);
     new_row_offsets[0] = csr_row_offsets[0];
     for (size_t i = 0; i < num_vertices; ++i) {
       new_row_offsets[i + 1] = new_row_offsets[i] +
@@ -112,10 +188,11 @@ private:
                                new_edge_counts[i];
     }
 
-    std::vector<size_t> new_col_vals(new_row_offsets.back());
-    std::vector<EdgeType> new_weights(new_row_offsets.back());
+    std::pmr::vector<size_t> new_col_vals(new_row_offsets.back(), _resource);
+    std::pmr::vector<EdgeType> new_weights(new_row_offsets.back(), _resource);
 
-    std::vector<size_t> insert_offsets = new_row_offsets;
+    std::vector<size_t> insert_offsets(new_row_offsets.begin(),
+                                       new_row_offsets.end());
     for (size_t row = 0; row < num_vertices; ++row) {
       size_t old_start = csr_row_offsets[row];
       size_t old_end = csr_row_offsets[row + 1];
@@ -148,6 +225,171 @@ private:
     clearCOOArrays();
   }
 
+  // Helpers below expect the caller to hold _mtx. Pending COO entries are
+  // searched newest first, then the CSR row (only populated once built).
+
+  // Position of src->dest in the CSR arrays, if present.
+  std::optional<size_t> csrEdgeIndex_nolock(size_t src_idx,
+                                            size_t dest_idx) const {
+    if (!is_built_.load(std::memory_order_acquire) ||
+        src_idx + 1 >= csr_row_offsets.size())
+      return std::nullopt;
+
+    auto first = csr_col_vals.begin() + csr_row_offsets[src_idx];
+    auto last = csr_col_vals.begin() + csr_row_offsets[src_idx + 1];
+    auto it = std::lower_bound(first, last, dest_idx);
+    if (it == last || *it != dest_idx)
+      return std::nullopt;
+    return static_cast<size_t>(std::distance(csr_col_vals.begin(), it));
+  }
+
+  std::optional<EdgeType> findEdge_nolock(size_t src_idx,
+                                          size_t dest_idx) const {
+    for (size_t i = coo_src.size(); i > 0; --i) {
+      if (coo_src[i - 1] == src_idx && coo_dest[i - 1] == dest_idx)
+        return coo_weights[i - 1];
+    }
+    if (auto idx = csrEdgeIndex_nolock(src_idx, dest_idx))
+      return csr_weights[*idx];
+    return std::nullopt;
+  }
+
+  EdgeType *edgeWeight_nolock(size_t src_idx, size_t dest_idx) {
+    for (size_t i = coo_src.size(); i > 0; --i) {
+      if (coo_src[i - 1] == src_idx && coo_dest[i - 1] == dest_idx)
+        return &coo_weights[i - 1];
+    }
+    if (auto idx = csrEdgeIndex_nolock(src_idx, dest_idx))
+      return &csr_weights[*idx];
+    return nullptr;
+  }
+
+  std::optional<EdgeType> removeEdge_nolock(size_t src_idx,
+                                            size_t dest_idx) {
+    for (size_t i = coo_src.size(); i > 0; --i) {
+      if (coo_src[i - 1] == src_idx && coo_dest[i - 1] == dest_idx) {
+        EdgeType weight = coo_weights[i - 1];
+        coo_src.erase(coo_src.begin() + (i - 1));
+        coo_dest.erase(coo_dest.begin() + (i - 1));
+        coo_weights.erase(coo_weights.begin() + (i - 1));
+        return weight;
+      }
+    }
+
+    auto idx = csrEdgeIndex_nolock(src_idx, dest_idx);
+    if (!idx)
+      return std::nullopt;
+    EdgeType weight = csr_weights[*idx];
+    csr_col_vals.erase(csr_col_vals.begin() + *idx);
+    csr_weights.erase(csr_weights.begin() + *idx);
+    for (size_t i = src_idx + 1; i < csr_row_offsets.size(); ++i)
+      csr_row_offsets[i]--;
+    return weight;
+  }
+
+  PeakStatus addVertex_nolock(const VertexType &vtx) {
+    if (vertex_to_index.contains(vtx)) {
+      return PeakStatus::AlreadyExists();
+    }
+    size_t new_idx = vertex_order.size();
+    vertex_order.push_back(vertex_to_index.insert(vtx, new_idx));
+    if (is_built_.load(std::memory_order_relaxed)) {
+      csr_row_offsets.push_back(csr_row_offsets.back());
+    }
+    return PeakStatus::OK();
+  }
+
+  PeakStatus removeVertex_nolock(const VertexType &vtx) {
+    auto vtx_idx = vertex_to_index.find(vtx);
+    if (!vtx_idx) {
+      return PeakStatus::VertexNotFound();
+    }
+
+    _tombstoned.insert(*vtx_idx);
+    vertex_to_index.erase(vertex_order[*vtx_idx]);
+    return PeakStatus::OK();
+  }
+
+  // Validated insert of src->dest, plus dest->src when bothDirections is set
+  // (the reverse direction is then always checked for duplicates).
+  PeakStatus insertEdge_nolock(const VertexType &src, const VertexType &dest,
+                               const EdgeType &weight,
+                               const EdgeInsertRules &rules,
+                               bool bothDirections) {
+    auto src_it = vertex_to_index.find(src);
+    auto dest_it = vertex_to_index.find(dest);
+    if (!src_it || !dest_it)
+      return PeakStatus::VertexNotFound(
+          "Source or destination vertex missing.");
+    if (*src_it == *dest_it)
+      return PeakStatus::InvalidArgument("Self loops are not allowed.");
+
+    auto conflicts = [&](size_t from, size_t to) {
+      auto existing = findEdge_nolock(from, to);
+      return existing && (!rules.weighted || *existing == weight);
+    };
+    if (conflicts(*src_it, *dest_it) ||
+        ((bothDirections || !rules.directed) && conflicts(*dest_it, *src_it)))
+      return PeakStatus::EdgeAlreadyExists("Edge already exists.");
+
+    if (bothDirections) {
+      coo_src.insert(coo_src.end(), {*src_it, *dest_it});
+      coo_dest.insert(coo_dest.end(), {*dest_it, *src_it});
+      coo_weights.insert(coo_weights.end(), {weight, weight});
+    } else {
+      coo_src.push_back(*src_it);
+      coo_dest.push_back(*dest_it);
+      coo_weights.push_back(weight);
+    }
+
+    if (is_built_.load(std::memory_order_relaxed) &&
+        coo_src.size() >=
+            COO_BUFFER_THRESHOLD_.load(std::memory_order_relaxed)) {
+      incrementalUpdate();
+    }
+    return PeakStatus::OK();
+  }
+
+  std::pair<EdgeType, PeakStatus>
+  removeEdgeBetween_nolock(const VertexType &src, const VertexType &dest,
+                           bool bothDirections) {
+    auto src_it = vertex_to_index.find(src);
+    auto dest_it = vertex_to_index.find(dest);
+    if (!src_it || !dest_it)
+      return std::make_pair(EdgeType(), PeakStatus::VertexNotFound());
+
+    auto removed = removeEdge_nolock(*src_it, *dest_it);
+    if (!removed)
+      return std::make_pair(EdgeType(), PeakStatus::EdgeNotFound());
+    if (bothDirections)
+      (void)removeEdge_nolock(*dest_it, *src_it);
+    return std::make_pair(*removed, PeakStatus::OK());
+  }
+
+  PeakStatus updateEdgeBetween_nolock(const VertexType &src,
+                                      const VertexType &dest,
+                                      const EdgeType &newWeight,
+                                      bool bothDirections) {
+    auto src_it = vertex_to_index.find(src);
+    auto dest_it = vertex_to_index.find(dest);
+    if (!src_it || !dest_it)
+      return PeakStatus::VertexNotFound();
+
+    EdgeType *forward = edgeWeight_nolock(*src_it, *dest_it);
+    if (!forward)
+      return PeakStatus::EdgeNotFound();
+    *forward = newWeight;
+    if (bothDirections) {
+      if (EdgeType *reverse = edgeWeight_nolock(*dest_it, *src_it))
+        *reverse = newWeight;
+    }
+    return PeakStatus::OK();
+  }
+
+  VertexType vertexValue(size_t idx) const {
+    return VertexType(vertex_to_index.value(vertex_order[idx]));
+  }
+
   void clearCOOArrays() noexcept {
     coo_src.clear();
     coo_dest.clear();
@@ -185,9 +427,9 @@ private:
     coo_weights.resize(write);
 
     if (is_built_.load(std::memory_order_relaxed)) {
-      std::vector<size_t> new_csr_cols;
-      std::vector<EdgeType> new_csr_weights;
-      std::vector<size_t> new_row_offsets;
+      std::pmr::vector<size_t> new_csr_cols(_resource);
+      std::pmr::vector<EdgeType> new_csr_weights(_resource);
+      std::pmr::vector<size_t> new_row_offsets(_resource);
       new_row_offsets.push_back(0);
 
       for (size_t old_row = 0; old_row < vertex_order.size(); ++old_row) {
@@ -210,25 +452,32 @@ private:
       csr_weights = std::move(new_csr_weights);
     }
 
-    std::vector<VertexType> new_vertex_order;
+    // A fresh index only re-registers live vertices, so names of removed
+    // ones leave the string arena.
+    std::pmr::vector<VertexKey> new_vertex_order(_resource);
+    VertexIndex<VertexType, size_t> new_index(_resource);
     new_vertex_order.reserve(vertex_order.size() - _tombstoned.size());
+    new_index.reserve(vertex_order.size() - _tombstoned.size());
     for (size_t i = 0; i < vertex_order.size(); ++i) {
       if (!_tombstoned.count(i)) {
-        new_vertex_order.push_back(std::move(vertex_order[i]));
+        new_vertex_order.push_back(new_index.insert(
+            vertex_to_index.value(vertex_order[i]), new_vertex_order.size()));
       }
     }
     vertex_order = std::move(new_vertex_order);
-
-    vertex_to_index.clear();
-    for (size_t i = 0; i < vertex_order.size(); ++i) {
-      vertex_to_index[vertex_order[i]] = i;
-    }
+    vertex_to_index = std::move(new_index);
 
     _tombstoned.clear();
   }
 
 public:
-  HybridCSR_COO() {
+  explicit HybridCSR_COO(
+      std::pmr::memory_resource *resource = std::pmr::get_default_resource())
+      : _resource(resource), csr_row_offsets(resource), csr_col_vals(resource),
+        csr_weights(resource), coo_src(resource), coo_dest(resource),
+        coo_weights(resource), vertex_order(resource),
+        vertex_to_index(resource), _tombstoned(resource),
+        csc_col_offsets(resource), csc_row_vals(resource) {
     csr_row_offsets.reserve(1024);
     csr_col_vals.reserve(4096);
     csr_weights.reserve(4096);
@@ -243,7 +492,7 @@ public:
       const std::unordered_map<VertexType,
                                std::vector<std::pair<VertexType, EdgeType>>,
                                VertexHasher<VertexType>> &adj_list) {
-    std::unique_lock<std::shared_mutex> lock(_mtx);
+    auto lock = writeLock();
 
     is_built_.store(false, std::memory_order_relaxed);
     clearCOOArrays();
@@ -252,24 +501,22 @@ public:
     _tombstoned.clear();
 
     for (const auto &[src, neighbors] : adj_list) {
-      auto src_it = vertex_to_index.find(src);
-      if (src_it == vertex_to_index.end()) {
-        vertex_to_index[src] = vertex_order.size();
-        vertex_order.push_back(src);
+      if (!vertex_to_index.contains(src)) {
+        vertex_order.push_back(
+            vertex_to_index.insert(src, vertex_order.size()));
       }
       for (const auto &[dest, weight] : neighbors) {
-        auto dest_it = vertex_to_index.find(dest);
-        if (dest_it == vertex_to_index.end()) {
-          vertex_to_index[dest] = vertex_order.size();
-          vertex_order.push_back(dest);
+        if (!vertex_to_index.contains(dest)) {
+          vertex_order.push_back(
+              vertex_to_index.insert(dest, vertex_order.size()));
         }
       }
     }
 
     for (const auto &[src, neighbors] : adj_list) {
-      size_t src_idx = vertex_to_index[src];
+      size_t src_idx = *vertex_to_index.find(src);
       for (const auto &[dest, weight] : neighbors) {
-        size_t dest_idx = vertex_to_index[dest];
+        size_t dest_idx = *vertex_to_index.find(dest);
         coo_src.push_back(src_idx);
         coo_dest.push_back(dest_idx);
         coo_weights.push_back(weight);
@@ -280,6 +527,125 @@ public:
     buildStructures();
   }
 
+  /**
+   * @brief Replaces the contents with an exported edge set.
+   *
+   * set.vertices[i] becomes index i and edges (1-based ids, as exported by
+   * AdjacencyList) are placed straight into sorted CSR rows with a counting
+   * sort, skipping the COO stage.
+   */
+  void loadEdgeSet(const BulkEdgeSet<VertexType, EdgeType> &set) {
+    auto lock = writeLock();
+    clearCOOArrays();
+    _tombstoned.clear();
+    vertex_order.clear();
+    vertex_to_index.clear();
+    const size_t n = set.vertices.size();
+    vertex_order.reserve(n);
+    for (size_t i = 0; i < n; ++i)
+      vertex_order.push_back(vertex_to_index.insert(set.vertices[i], i));
+
+    csr_row_offsets.assign(n + 1, 0);
+    for (const auto &edge : set.edges)
+      ++csr_row_offsets[edge.src];
+    for (size_t v = 0; v < n; ++v)
+      csr_row_offsets[v + 1] += csr_row_offsets[v];
+    csr_col_vals.resize(set.edges.size());
+    csr_weights.resize(set.edges.size());
+    std::vector<size_t> next(csr_row_offsets.begin(),
+                             csr_row_offsets.end() - 1);
+    for (const auto &edge : set.edges) {
+      size_t pos = next[edge.src - 1]++;
+      csr_col_vals[pos] = edge.dest - 1;
+      csr_weights[pos] = edge.weight;
+    }
+    for (size_t v = 0; v < n; ++v) {
+      size_t first = csr_row_offsets[v];
+      size_t last = csr_row_offsets[v + 1];
+      if (std::is_sorted(csr_col_vals.begin() + first,
+                         csr_col_vals.begin() + last))
+        continue;
+      std::vector<std::pair<size_t, EdgeType>> row;
+      row.reserve(last - first);
+      for (size_t e = first; e < last; ++e)
+        row.emplace_back(csr_col_vals[e], csr_weights[e]);
+      std::sort(row.begin(), row.end(),
+                [](const auto &a, const auto &b) { return a.first < b.first; });
+      for (size_t e = first; e < last; ++e) {
+        csr_col_vals[e] = row[e - first].first;
+        csr_weights[e] = row[e - first].second;
+      }
+    }
+    is_built_.store(true, std::memory_order_release);
+  }
+
+  // Index lookups for withCSR callbacks; valid only inside the callback.
+  class IndexMap {
+    const HybridCSR_COO &_owner;
+
+  public:
+    explicit IndexMap(const HybridCSR_COO &owner) : _owner(owner) {}
+    std::optional<size_t> index(LookupKey v) const {
+      return _owner.vertex_to_index.find(v);
+    }
+    VertexType value(size_t idx) const { return _owner.vertexValue(idx); }
+    // Every vertex by index, shared with other callbacks on this version.
+    std::shared_ptr<const Algorithms::VertexTable<VertexType>>
+    table() const {
+      return _owner.vertexTable_nolock();
+    }
+  };
+
+  /**
+   * @brief Runs fn(view, map) over the CSR arrays under the read lock.
+   *
+   * Buffered COO edges and tombstones are merged first, so the view covers
+   * every vertex and edge with dense indices. The view always carries
+   * in-edges: the cached transpose on directed graphs, the out arrays
+   * themselves on undirected ones (whose rows are symmetric). Callers that
+   * never read the in-edges pass directed = false to skip the transpose.
+   *
+   * @return Whatever fn returns.
+   */
+  template <typename Fn>
+  decltype(auto) withCSR(bool directed, Fn &&fn) const {
+    return withWeightedCSR(
+        directed, [&](const Algorithms::CSRView &view, const EdgeType *,
+                      const IndexMap &map) { return fn(view, map); });
+  }
+
+  /**
+   * @brief Like withCSR, but fn(view, weights, map) also receives the edge
+   * weights: weights[e] belongs to view.targets[e].
+   */
+  template <typename Fn>
+  decltype(auto) withWeightedCSR(bool directed, Fn &&fn) const {
+    auto *self = const_cast<HybridCSR_COO *>(this);
+    self->buildStructures();
+    {
+      std::unique_lock<std::shared_mutex> lock(_mtx);
+      if (!coo_src.empty() || !_tombstoned.empty()) {
+        ++self->_csr_version;
+        self->incrementalUpdate();
+      }
+    }
+    std::shared_lock<std::shared_mutex> lock(_mtx);
+    Algorithms::CSRView view;
+    view.vertices = vertex_order.size();
+    view.offsets = csr_row_offsets.data();
+    view.targets = csr_col_vals.data();
+    if (directed) {
+      buildTranspose_nolock();
+      view.inOffsets = csc_col_offsets.data();
+      view.inTargets = csc_row_vals.data();
+    } else {
+      view.inOffsets = view.offsets;
+      view.inTargets = view.targets;
+    }
+    return fn(static_cast<const Algorithms::CSRView &>(view),
+              csr_weights.data(), IndexMap(*this));
+  }
+
   void setCOOThreshold(size_t threshold) {
     COO_BUFFER_THRESHOLD_.store(threshold, std::memory_order_relaxed);
   }
@@ -292,7 +658,7 @@ public:
   }
 
   void orchestrator_mergeBuffer() {
-    std::unique_lock<std::shared_mutex> lock(_mtx);
+    auto lock = writeLock();
     incrementalUpdate();
   }
 
@@ -307,12 +673,12 @@ public:
     for (size_t i = 0; i < vertex_order.size(); ++i) {
       if (_tombstoned.count(i))
         continue;
-      std::cout << vertex_order[i] << " [" << i << "] -> ";
+      std::cout << vertexValue(i) << " [" << i << "] -> ";
       for (size_t j = csr_row_offsets[i]; j < csr_row_offsets[i + 1]; ++j) {
         size_t neighbor_idx = csr_col_vals[j];
         if (_tombstoned.count(neighbor_idx))
           continue;
-        std::cout << "(" << vertex_order[neighbor_idx] << " [" << neighbor_idx
+        std::cout << "(" << vertexValue(neighbor_idx) << " [" << neighbor_idx
                   << "], " << csr_weights[j] << ") ";
       }
       std::cout << "\n";
@@ -321,35 +687,24 @@ public:
 
   [[nodiscard]] const PeakStatus
   impl_addVertex(const VertexType &vtx) override {
-    std::unique_lock<std::shared_mutex> lock(_mtx);
-
-    auto vtx_it = vertex_to_index.find(vtx);
-    if (vtx_it != vertex_to_index.end()) {
-      return PeakStatus::AlreadyExists();
-    }
-    size_t new_idx = vertex_order.size();
-    vertex_to_index[vtx] = new_idx;
-    vertex_order.push_back(vtx);
-    if (is_built_.load(std::memory_order_relaxed)) {
-      csr_row_offsets.push_back(csr_row_offsets.back());
-    }
-    return PeakStatus::OK();
+    auto lock = writeLock();
+    return addVertex_nolock(vtx);
   }
 
   [[nodiscard]] const PeakStatus
   impl_addEdge(const VertexType &src, const VertexType &dest,
                const EdgeType &weight = EdgeType()) override {
 
-    std::unique_lock<std::shared_mutex> lock(_mtx);
+    auto lock = writeLock();
 
     auto src_it = vertex_to_index.find(src);
     auto dest_it = vertex_to_index.find(dest);
-    if (src_it == vertex_to_index.end() || dest_it == vertex_to_index.end()) {
+    if (!src_it || !dest_it) {
       return PeakStatus::VertexNotFound();
     }
 
-    coo_src.push_back(src_it->second);
-    coo_dest.push_back(dest_it->second);
+    coo_src.push_back(*src_it);
+    coo_dest.push_back(*dest_it);
     coo_weights.push_back(weight);
 
     if (is_built_.load(std::memory_order_relaxed) &&
@@ -360,72 +715,54 @@ public:
     return PeakStatus::OK();
   }
 
+  [[nodiscard]] const PeakStatus
+  impl_addEdgeChecked(const VertexType &src, const VertexType &dest,
+                      const EdgeType &weight,
+                      const EdgeInsertRules &rules) override {
+    auto lock = writeLock();
+    return insertEdge_nolock(src, dest, weight, rules, false);
+  }
+
   [[nodiscard]] const std::pair<EdgeType, PeakStatus>
   impl_removeEdge(const VertexType &src, const VertexType &dest) override {
-    std::unique_lock<std::shared_mutex> lock(_mtx);
-
-    auto weight = EdgeType();
-
-    auto src_it = vertex_to_index.find(src);
-    auto dest_it = vertex_to_index.find(dest);
-    if (src_it == vertex_to_index.end() || dest_it == vertex_to_index.end()) {
-      return std::make_pair(weight, PeakStatus::VertexNotFound());
-    }
-
-    size_t src_idx = src_it->second;
-    size_t dest_idx = dest_it->second;
-
-    for (size_t i = coo_src.size(); i > 0; --i) {
-      if (coo_src[i - 1] == src_idx && coo_dest[i - 1] == dest_idx) {
-        coo_src.erase(coo_src.begin() + (i - 1));
-        coo_dest.erase(coo_dest.begin() + (i - 1));
-        weight = coo_weights[i - 1];
-        coo_weights.erase(coo_weights.begin() + (i - 1));
-        return std::make_pair(weight, PeakStatus::OK());
-      }
-    }
-
-    if (!is_built_.load(std::memory_order_acquire)) {
-      return std::make_pair(weight, PeakStatus::EdgeNotFound());
-    }
-
-    size_t row = src_idx;
-    size_t start = csr_row_offsets[row];
-    size_t end = csr_row_offsets[row + 1];
-
-    auto it = std::lower_bound(csr_col_vals.begin() + start,
-                               csr_col_vals.begin() + end, dest_idx);
-
-    if (it != csr_col_vals.begin() + end && *it == dest_idx) {
-      size_t edge_idx = std::distance(csr_col_vals.begin(), it);
-
-      weight = csr_weights[edge_idx];
+    auto lock = writeLock();
+    return removeEdgeBetween_nolock(src, dest, false);
+  }
 
-      csr_col_vals.erase(csr_col_vals.begin() + edge_idx);
-      csr_weights.erase(csr_weights.begin() + edge_idx);
+  [[nodiscard]] const PeakStatus
+  impl_addEdgePair(const VertexType &src, const VertexType &dest,
+                   const EdgeType &weight,
+                   const EdgeInsertRules &rules) override {
+    auto lock = writeLock();
+    return insertEdge_nolock(src, dest, weight, rules, true);
+  }
 
-      for (size_t i = row + 1; i < csr_row_offsets.size(); ++i) {
-        csr_row_offsets[i]--;
-      }
+  [[nodiscard]] const std::pair<EdgeType, PeakStatus>
+  impl_removeEdgePair(const VertexType &src, const VertexType &dest) override {
+    auto lock = writeLock();
+    return removeEdgeBetween_nolock(src, dest, true);
+  }
 
-      return std::make_pair(weight, PeakStatus::OK());
-    }
-    return std::make_pair(weight, PeakStatus::EdgeNotFound());
+  [[nodiscard]] const PeakStatus
+  impl_updateEdgePair(const VertexType &src, const VertexType &dest,
+                      const EdgeType &newWeight) override {
+    auto lock = writeLock();
+    return updateEdgeBetween_nolock(src, dest, newWeight, true);
   }
 
   [[nodiscard]] const PeakStatus
   impl_updateEdge(const VertexType &src, const VertexType &dest,
                   const EdgeType &newWeight) override {
+    auto lock = writeLock();
+
     auto src_it = vertex_to_index.find(src);
     auto dest_it = vertex_to_index.find(dest);
-    if (src_it == vertex_to_index.end() || dest_it == vertex_to_index.end()) {
+    if (!src_it || !dest_it) {
       return PeakStatus::VertexNotFound();
     }
 
-    std::unique_lock<std::shared_mutex> lock(_mtx);
-
-    size_t src_idx = src_it->second;
-    size_t dest_idx = dest_it->second;
+    size_t src_idx = *src_it;
+    size_t dest_idx = *dest_it;
 
     for (size_t i = coo_src.size(); i > 0; --i) {
       if (coo_src[i - 1] == src_idx && coo_dest[i - 1] == dest_idx) {
@@ -457,7 +794,7 @@ public:
   }
 
   [[nodiscard]] const PeakStatus impl_clearVertices() override {
-    std::unique_lock<std::shared_mutex> lock(_mtx);
+    auto lock = writeLock();
     clearCOOArrays();
 
     if (is_built_.load(std::memory_order_relaxed)) {
@@ -478,7 +815,7 @@ public:
   }
 
   [[nodiscard]] const PeakStatus impl_clearEdges() override {
-    std::unique_lock<std::shared_mutex> lock(_mtx);
+    auto lock = writeLock();
     clearCOOArrays();
 
     if (is_built_.load(std::memory_order_relaxed)) {
@@ -492,39 +829,38 @@ public:
     return PeakStatus::OK();
   }
 
-  [[nodiscard]] bool impl_hasVertex(const VertexType &v) noexcept override {
+  [[nodiscard]] bool impl_hasVertex(LookupKey v) noexcept override {
     std::shared_lock<std::shared_mutex> lock(_mtx);
-    if (!vertex_to_index.count(v)) {
+    if (!vertex_to_index.contains(v)) {
       return false;
     }
     return true;
   }
 
   [[nodiscard]] bool
-  impl_doesEdgeExist(const VertexType &src, const VertexType &dest,
+  impl_doesEdgeExist(LookupKey src, LookupKey dest,
                      const EdgeType &weight) noexcept override {
     auto edge = impl_getEdge(src, dest);
     return edge.second.isOK() && edge.first == weight;
   }
 
-  [[nodiscard]] bool
-  impl_doesEdgeExist(const VertexType &src,
-                     const VertexType &dest) noexcept override {
+  [[nodiscard]] bool impl_doesEdgeExist(LookupKey src,
+                                        LookupKey dest) noexcept override {
     return impl_getEdge(src, dest).second.isOK();
   }
 
   [[nodiscard]] const std::pair<EdgeType, PeakStatus>
-  impl_getEdge(const VertexType &src, const VertexType &dest) override {
+  impl_getEdge(LookupKey src, LookupKey dest) override {
     std::shared_lock<std::shared_mutex> lock(_mtx);
 
     auto src_it = vertex_to_index.find(src);
     auto dest_it = vertex_to_index.find(dest);
-    if (src_it == vertex_to_index.end() || dest_it == vertex_to_index.end()) {
+    if (!src_it || !dest_it) {
       return {EdgeType{}, PeakStatus::VertexNotFound()};
     }
 
-    size_t src_idx = src_it->second;
-    size_t dest_idx = dest_it->second;
+    size_t src_idx = *src_it;
+    size_t dest_idx = *dest_it;
 
     for (size_t i = coo_src.size(); i > 0; --i) {
       if (coo_src[i - 1] == src_idx && coo_dest[i - 1] == dest_idx) {
@@ -553,17 +889,44 @@ public:
 
   [[nodiscard]] const PeakStatus
   impl_removeVertex(const VertexType &vtx) override {
-    std::unique_lock<std::shared_mutex> lock(_mtx);
+    auto lock = writeLock();
+    return removeVertex_nolock(vtx);
+  }
 
-    auto vtx_it = vertex_to_index.find(vtx);
-    if (vtx_it == vertex_to_index.end()) {
-      return PeakStatus::VertexNotFound();
+  [[nodiscard]] BatchResult
+  impl_applyBatch(const WriteBatch<VertexType, EdgeType> &batch,
+                  const EdgeInsertRules &rules) override {
+    using Op = typename WriteBatch<VertexType, EdgeType>::Op;
+    const bool pair = !rules.directed;
+    BatchResult result(batch.size());
+
+    auto lock = writeLock();
+    const auto &ops = batch.ops();
+    for (size_t i = 0; i < ops.size(); ++i) {
+      const Op &op = ops[i];
+      PeakStatus status = PeakStatus::OK();
+      switch (op.kind) {
+      case BatchOpKind::AddVertex:
+        status = addVertex_nolock(op.src);
+        break;
+      case BatchOpKind::RemoveVertex:
+        status = removeVertex_nolock(op.src);
+        break;
+      case BatchOpKind::AddEdge:
+        status = insertEdge_nolock(op.src, op.dest,
+                                   rules.weighted ? op.weight : EdgeType(),
+                                   rules, pair);
+        break;
+      case BatchOpKind::RemoveEdge:
+        status = removeEdgeBetween_nolock(op.src, op.dest, pair).second;
+        break;
+      case BatchOpKind::UpdateEdge:
+        status = updateEdgeBetween_nolock(op.src, op.dest, op.weight, pair);
+        break;
+      }
+      result.record(i, op.kind, status, pair ? 2 : 1);
     }
-
-    _tombstoned.insert(vtx_it->second);
-    vertex_to_index.erase(vtx_it);
-
-    return PeakStatus::OK();
+    return result;
   }
   [[nodiscard]] std::vector<VertexType> impl_getVertices() const override {
     std::shared_lock<std::shared_mutex> lock(_mtx);
@@ -571,7 +934,7 @@ public:
     result.reserve(vertex_order.size());
     for (size_t i = 0; i < vertex_order.size(); ++i) {
       if (!_tombstoned.count(i)) {
-        result.push_back(vertex_order[i]);
+        result.push_back(vertexValue(i));
       }
     }
     return result;
@@ -589,7 +952,7 @@ public:
         size_t neighbor_idx = csr_col_vals[j];
         if (_tombstoned.count(neighbor_idx))
           continue;
-        result.emplace_back(vertex_order[i], vertex_order[neighbor_idx],
+        result.emplace_back(vertexValue(i), vertexValue(neighbor_idx),
                             csr_weights[j]);
       }
     }
@@ -0,0 +1,113 @@
+#pragma once
+#include "StorageEngine/ErrorCodes.hpp"
+#include <cstddef>
+#include <string>
+#include <utility>
+#if defined(_WIN32)
+#include <fstream>
+#include <iterator>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace CinderPeak {
+namespace PeakStore {
+
+/**
+ * @brief Read-only view of a whole file.
+ *
+ * On POSIX systems the file is mmapped (with a sequential-access hint), so
+ * parsers read straight from the page cache with no copy. Elsewhere it is
+ * read into memory once. Move-only; the view is released on destruction.
+ */
+class MappedFile {
+  const char *_data = nullptr;
+  size_t _size = 0;
+#if defined(_WIN32)
+  std::string _contents;
+#else
+  void *_map = nullptr;
+#endif
+
+  void release() noexcept {
+#if !defined(_WIN32)
+    if (_map)
+      ::munmap(_map, _size);
+    _map = nullptr;
+#endif
+    _data = nullptr;
+    _size = 0;
+  }
+
+public:
+  MappedFile() = default;
+  MappedFile(const MappedFile &) = delete;
+  MappedFile &operator=(const MappedFile &) = delete;
+
+  MappedFile(MappedFile &&other) noexcept { *this = std::move(other); }
+
+  MappedFile &operator=(MappedFile &&other) noexcept {
+    if (this != &other) {
+      release();
+#if defined(_WIN32)
+      _contents = std::move(other._contents);
+      _data = _contents.data();
+#else
+      _map = std::exchange(other._map, nullptr);
+      _data = other._data;
+#endif
+      _size = std::exchange(other._size, 0);
+      other._data = nullptr;
+    }
+    return *this;
+  }
+
+  ~MappedFile() { release(); }
+
+  static std::pair<MappedFile, PeakStatus> open(const std::string &path) {
+    MappedFile file;
+#if defined(_WIN32)
+    std::ifstream in(path, std::ios::binary);
+    if (!in)
+      return {std::move(file), PeakStatus::NotFound("Cannot open " + path)};
+    file._contents.assign(std::istreambuf_iterator<char>(in),
+                          std::istreambuf_iterator<char>());
+    file._data = file._contents.data();
+    file._size = file._contents.size();
+#else
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0)
+      return {std::move(file), PeakStatus::NotFound("Cannot open " + path)};
+    struct stat info;
+    if (::fstat(fd, &info) != 0) {
+      ::close(fd);
+      return {std::move(file),
+              PeakStatus::InternalError("Cannot stat " + path)};
+    }
+    file._size = static_cast<size_t>(info.st_size);
+    if (file._size > 0) {
+      void *map = ::mmap(nullptr, file._size, PROT_READ, MAP_PRIVATE, fd, 0);
+      if (map == MAP_FAILED) {
+        ::close(fd);
+        file._size = 0;
+        return {std::move(file),
+                PeakStatus::InternalError("Cannot mmap " + path)};
+      }
+      ::madvise(map, file._size, MADV_SEQUENTIAL);
+      file._map = map;
+      file._data = static_cast<const char *>(map);
+    }
+    ::close(fd);
+#endif
+    return {std::move(file), PeakStatus::OK()};
+  }
+
+  const char *data() const noexcept { return _data; }
+  size_t size() const noexcept { return _size; }
+};
+
+} // namespace PeakStore
+} // namespace CinderPeak
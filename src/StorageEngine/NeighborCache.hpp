@@ -0,0 +1,250 @@
+#pragma once
+#include "StorageEngine/ShardedCounter.hpp"
+#include "StorageEngine/Utils.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+#include <utility>
+#include <vector>
+
+namespace CinderPeak {
+
+struct NeighborCacheStats {
+  size_t hits = 0;
+  size_t misses = 0;
+  size_t entries = 0;
+  size_t capacity = 0;
+};
+
+namespace PeakStore {
+
+/**
+ * @brief Bounded cache of materialised getNeighbors() results.
+ *
+ * Holds up to capacity rows in a fixed slot array with CLOCK replacement:
+ * a hit sets the slot's reference bit under the shared lock, and eviction
+ * sweeps the hand past referenced slots, clearing their bits. Slots are
+ * found through chained buckets hashed with VertexHasher, so string
+ * vertices are looked up by std::string_view without allocating.
+ *
+ * The cache does not watch storage itself; PeakStore wires invalidate(),
+ * invalidateReferencing() and clear() to the graph's EventHub. Every
+ * invalidation bumps an epoch, and insert() drops a row read before the
+ * latest invalidation, so a reader racing a writer never caches a stale
+ * row.
+ */
+template <typename VertexType, typename EdgeType> class NeighborCache {
+public:
+  using LookupKey = VertexLookupKey<VertexType>;
+  using Row = std::vector<std::pair<VertexType, EdgeType>>;
+
+private:
+  static constexpr uint32_t NONE = UINT32_MAX;
+
+  struct Slot {
+    VertexType key{};
+    Row row;
+    size_t hash = 0;
+    uint32_t next = NONE;
+    bool used = false;
+    std::atomic<bool> referenced{false};
+  };
+
+  mutable std::shared_mutex _mtx;
+  std::unique_ptr<Slot[]> _slots;
+  std::vector<uint32_t> _buckets;
+  std::vector<uint32_t> _free;
+  size_t _capacity = 0;
+  size_t _size = 0;
+  size_t _hand = 0;
+  std::atomic<uint64_t> _epoch{0};
+  mutable ShardedCounter _hits;
+  mutable ShardedCounter _misses;
+
+  size_t bucketOf(size_t hash) const { return hash & (_buckets.size() - 1); }
+
+  template <typename Key> uint32_t find_nolock(const Key &key) const {
+    if (_capacity == 0)
+      return NONE;
+    size_t hash = VertexHasher<VertexType>{}(key);
+    for (uint32_t i = _buckets[bucketOf(hash)]; i != NONE; i = _slots[i].next) {
+      const Slot &s = _slots[i];
+      if (s.hash == hash && VertexEqual<VertexType>{}(s.key, key))
+        return i;
+    }
+    return NONE;
+  }
+
+  void unlink_nolock(uint32_t slot) {
+    uint32_t *link = &_buckets[bucketOf(_slots[slot].hash)];
+    while (*link != slot)
+      link = &_slots[*link].next;
+    *link = _slots[slot].next;
+  }
+
+  void release_nolock(uint32_t slot) {
+    unlink_nolock(slot);
+    Slot &s = _slots[slot];
+    Row().swap(s.row);
+    s.used = false;
+    s.next = NONE;
+    s.referenced.store(false, std::memory_order_relaxed);
+    _free.push_back(slot);
+    --_size;
+  }
+
+  // Frees the first slot the clock hand finds unreferenced.
+  void evict_nolock() {
+    for (;;) {
+      Slot &s = _slots[_hand];
+      uint32_t slot = static_cast<uint32_t>(_hand);
+      _hand = (_hand + 1) % _capacity;
+      if (s.used && !s.referenced.exchange(false, std::memory_order_relaxed)) {
+        release_nolock(slot);
+        return;
+      }
+    }
+  }
+
+  // Empties the capacity slots of _slots and starts a new epoch.
+  void reset_nolock(size_t capacity) {
+    _capacity = capacity;
+    for (size_t i = 0; i < capacity; ++i) {
+      Slot &s = _slots[i];
+      s.key = VertexType{};
+      s.row.clear();
+      s.hash = 0;
+      s.next = NONE;
+      s.used = false;
+      s.referenced.store(false, std::memory_order_relaxed);
+    }
+    size_t buckets = 1;
+    while (buckets < capacity * 2)
+      buckets <<= 1;
+    _buckets.assign(capacity ? buckets : 0, NONE);
+    _free.clear();
+    for (size_t i = capacity; i-- > 0;)
+      _free.push_back(static_cast<uint32_t>(i));
+    _size = 0;
+    _hand = 0;
+    _epoch.fetch_add(1, std::memory_order_release);
+  }
+
+public:
+  explicit NeighborCache(size_t capacity = 0) { resize(capacity); }
+
+  NeighborCache(const NeighborCache &) = delete;
+  NeighborCache &operator=(const NeighborCache &) = delete;
+
+  // Drops every row and reallocates for the new capacity; 0 disables the
+  // cache.
+  void resize(size_t capacity) {
+    std::unique_lock<std::shared_mutex> lock(_mtx);
+    capacity = std::min<size_t>(capacity, NONE - 1);
+    _slots = capacity ? std::make_unique<Slot[]>(capacity) : nullptr;
+    reset_nolock(capacity);
+  }
+
+  bool enabled() const {
+    std::shared_lock<std::shared_mutex> lock(_mtx);
+    return _capacity > 0;
+  }
+
+  // Copy of the cached row for key, counting a hit or a miss.
+  std::optional<Row> find(LookupKey key) const {
+    std::shared_lock<std::shared_mutex> lock(_mtx);
+    if (_capacity == 0)
+      return std::nullopt;
+    uint32_t slot = find_nolock(key);
+    if (slot == NONE) {
+      _misses.add(1);
+      return std::nullopt;
+    }
+    _slots[slot].referenced.store(true, std::memory_order_relaxed);
+    _hits.add(1);
+    return _slots[slot].row;
+  }
+
+  // Read before loading a row from storage and passed to insert().
+  uint64_t epoch() const { return _epoch.load(std::memory_order_acquire); }
+
+  // Caches row for key unless an invalidation happened since epoch was read.
+  void insert(LookupKey key, const Row &row, uint64_t epoch) {
+    std::unique_lock<std::shared_mutex> lock(_mtx);
+    if (_capacity == 0 || _epoch.load(std::memory_order_relaxed) != epoch)
+      return;
+    uint32_t slot = find_nolock(key);
+    if (slot == NONE) {
+      if (_free.empty())
+        evict_nolock();
+      slot = _free.back();
+      _free.pop_back();
+      Slot &s = _slots[slot];
+      s.key = VertexType(key);
+      s.hash = VertexHasher<VertexType>{}(key);
+      s.used = true;
+      uint32_t &head = _buckets[bucketOf(s.hash)];
+      s.next = head;
+      head = slot;
+      ++_size;
+    }
+    _slots[slot].row = row;
+    _slots[slot].referenced.store(false, std::memory_order_relaxed);
+  }
+
+  // Drops the row of v after its out-edges changed.
+  void invalidate(const VertexType &v) {
+    std::unique_lock<std::shared_mutex> lock(_mtx);
+    _epoch.fetch_add(1, std::memory_order_release);
+    if (uint32_t slot = find_nolock(v); slot != NONE)
+      release_nolock(slot);
+  }
+
+  // Drops the row of v and every cached row listing v as a neighbor, for
+  // vertex removal. O(cached rows).
+  void invalidateReferencing(const VertexType &v) {
+    std::unique_lock<std::shared_mutex> lock(_mtx);
+    _epoch.fetch_add(1, std::memory_order_release);
+    VertexEqual<VertexType> equal;
+    for (size_t i = 0; i < _capacity; ++i) {
+      const Slot &s = _slots[i];
+      if (!s.used)
+        continue;
+      bool stale = equal(s.key, v) ||
+                   std::any_of(s.row.begin(), s.row.end(), [&](const auto &n) {
+                     return equal(n.first, v);
+                   });
+      if (stale)
+        release_nolock(static_cast<uint32_t>(i));
+    }
+  }
+
+  // Drops every row, keeping the allocation.
+  void clear() {
+    std::unique_lock<std::shared_mutex> lock(_mtx);
+    reset_nolock(_capacity);
+  }
+
+  size_t capacity() const {
+    std::shared_lock<std::shared_mutex> lock(_mtx);
+    return _capacity;
+  }
+
+  NeighborCacheStats stats() const {
+    std::shared_lock<std::shared_mutex> lock(_mtx);
+    return {_hits.load(), _misses.load(), _size, _capacity};
+  }
+
+  void resetStats() {
+    _hits.store(0);
+    _misses.store(0);
+  }
+};
+
+} // namespace PeakStore
+} // namespace CinderPeak
@@ -0,0 +1,152 @@
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace CinderPeak {
+namespace PeakStore {
+
+// Below this many items per worker, spawning a thread costs more than it
+// saves.
+inline constexpr size_t MIN_ITEMS_PER_WORKER = size_t{1} << 14;
+
+// Number of workers to use for n items: at most maxWorkers (one per
+// hardware thread when 0) and never fewer than minPerWorker items each.
+inline size_t workerCount(size_t n,
+                          size_t minPerWorker = MIN_ITEMS_PER_WORKER,
+                          size_t maxWorkers = 0) {
+  if (maxWorkers == 0)
+    maxWorkers = std::max<size_t>(1, std::thread::hardware_concurrency());
+  size_t wanted = n / std::max<size_t>(1, minPerWorker);
+  return std::max<size_t>(1, std::min(maxWorkers, wanted));
+}
+
+/**
+ * @brief Runs fn(worker, begin, end) over [0, n) split into contiguous slices.
+ *
+ * Slice 0 runs on the calling thread. Returns once every slice is done and
+ * rethrows the first exception thrown by any worker.
+ */
+template <typename Fn> void parallelFor(size_t n, size_t workers, Fn &&fn) {
+  workers = std::max<size_t>(1, std::min(workers, n));
+  if (workers <= 1) {
+    fn(size_t{0}, size_t{0}, n);
+    return;
+  }
+
+  std::exception_ptr error;
+  std::mutex error_mtx;
+  auto run = [&](size_t w) {
+    try {
+      fn(w, n * w / workers, n * (w + 1) / workers);
+    } catch (...) {
+      std::lock_guard<std::mutex> lock(error_mtx);
+      if (!error)
+        error = std::current_exception();
+    }
+  };
+
+  std::vector<std::thread> threads;
+  threads.reserve(workers - 1);
+  for (size_t w = 1; w < workers; ++w)
+    threads.emplace_back(run, w);
+  run(0);
+  for (auto &t : threads)
+    t.join();
+  if (error)
+    std::rethrow_exception(error);
+}
+
+/**
+ * @brief Runs fn(worker, begin, end) over [0, n) in chunks claimed
+ * dynamically.
+ *
+ * Workers take the next chunk from a shared counter, so uneven per-item
+ * cost (skewed degrees) evens out instead of stalling one static slice.
+ */
+template <typename Fn>
+void parallelForDynamic(size_t n, size_t workers, size_t chunk, Fn &&fn) {
+  chunk = std::max<size_t>(1, chunk);
+  workers = std::min(workers, (n + chunk - 1) / chunk);
+  std::atomic<size_t> next{0};
+  parallelFor(workers, workers, [&](size_t w, size_t, size_t) {
+    size_t begin;
+    while ((begin = next.fetch_add(chunk, std::memory_order_relaxed)) < n)
+      fn(w, begin, std::min(n, begin + chunk));
+  });
+}
+
+/**
+ * @brief Reusable barrier for a fixed number of threads.
+ *
+ * Lets the workers of one parallelFor call run many synchronized rounds
+ * without starting new threads for each.
+ */
+class Barrier {
+  std::mutex _mtx;
+  std::condition_variable _cv;
+  const size_t _count;
+  size_t _waiting = 0;
+  size_t _generation = 0;
+
+public:
+  explicit Barrier(size_t count) : _count(count) {}
+
+  // Blocks until all count threads have called wait() for this round.
+  void wait() {
+    std::unique_lock<std::mutex> lock(_mtx);
+    const size_t generation = _generation;
+    if (++_waiting == _count) {
+      _waiting = 0;
+      ++_generation;
+      _cv.notify_all();
+      return;
+    }
+    _cv.wait(lock, [&] { return generation != _generation; });
+  }
+};
+
+/**
+ * @brief Sorts v by sorting one run per worker, then merging runs pairwise.
+ *
+ * Not stable. Merges of one round run concurrently, so the sort takes
+ * log2(workers) merge rounds after the initial run sorts.
+ */
+template <typename T, typename Compare>
+void parallelSort(std::vector<T> &v, Compare cmp, size_t workers) {
+  workers = std::max<size_t>(1, std::min(workers, v.size()));
+  if (workers <= 1) {
+    std::sort(v.begin(), v.end(), cmp);
+    return;
+  }
+
+  std::vector<size_t> bounds(workers + 1);
+  for (size_t i = 0; i <= workers; ++i)
+    bounds[i] = v.size() * i / workers;
+
+  parallelFor(workers, workers, [&](size_t, size_t first, size_t last) {
+    for (size_t run = first; run < last; ++run)
+      std::sort(v.begin() + bounds[run], v.begin() + bounds[run + 1], cmp);
+  });
+
+  for (size_t width = 1; width < workers; width *= 2) {
+    size_t merges = (workers - width + 2 * width - 1) / (2 * width);
+    parallelFor(merges, merges, [&](size_t, size_t first, size_t last) {
+      for (size_t m = first; m < last; ++m) {
+        size_t lo = 2 * width * m;
+        size_t mid = lo + width;
+        size_t hi = std::min(lo + 2 * width, workers);
+        std::inplace_merge(v.begin() + bounds[lo], v.begin() + bounds[mid],
+                           v.begin() + bounds[hi], cmp);
+      }
+    });
+  }
+}
+
+} // namespace PeakStore
+} // namespace CinderPeak
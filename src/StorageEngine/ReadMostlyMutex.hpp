@@ -0,0 +1,84 @@
+#pragma once
+#include "StorageEngine/ShardedCounter.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <shared_mutex>
+#include <thread>
+
+namespace CinderPeak {
+namespace PeakStore {
+
+/**
+ * @brief Reader-writer lock whose readers do not share a cache line.
+ *
+ * A plain std::shared_mutex makes every reader write the same reader count,
+ * so concurrent lookups bounce one cache line between cores. This lock keeps
+ * one padded shared_mutex per shard. Each thread takes a shared lock only on
+ * its own shard, and writers lock every shard in order.
+ *
+ * Reads scale with the core count. Writes cost one uncontended lock per
+ * shard, so use it for read-mostly structures.
+ *
+ * Meets the SharedMutex requirements and works with std::shared_lock and
+ * std::unique_lock. A thread must unlock_shared() from the thread that
+ * called lock_shared(), as with any mutex.
+ */
+class ReadMostlyMutex {
+private:
+  static constexpr size_t MAX_SHARDS = 16;
+
+  struct alignas(64) Shard {
+    std::shared_mutex mtx;
+  };
+
+  std::unique_ptr<Shard[]> _shards;
+  size_t _mask;
+
+  Shard &readerShard() const noexcept {
+    return _shards[threadSlot() & _mask];
+  }
+
+public:
+  ReadMostlyMutex()
+      : ReadMostlyMutex(
+            std::max<size_t>(1, std::thread::hardware_concurrency())) {}
+
+  explicit ReadMostlyMutex(size_t threads)
+      : _shards(std::make_unique<Shard[]>(shardCountFor(threads, MAX_SHARDS))),
+        _mask(shardCountFor(threads, MAX_SHARDS) - 1) {}
+
+  ReadMostlyMutex(const ReadMostlyMutex &) = delete;
+  ReadMostlyMutex &operator=(const ReadMostlyMutex &) = delete;
+
+  void lock() {
+    for (size_t i = 0; i <= _mask; ++i)
+      _shards[i].mtx.lock();
+  }
+
+  bool try_lock() {
+    for (size_t i = 0; i <= _mask; ++i) {
+      if (!_shards[i].mtx.try_lock()) {
+        while (i-- > 0)
+          _shards[i].mtx.unlock();
+        return false;
+      }
+    }
+    return true;
+  }
+
+  void unlock() {
+    for (size_t i = _mask + 1; i-- > 0;)
+      _shards[i].mtx.unlock();
+  }
+
+  void lock_shared() { readerShard().mtx.lock_shared(); }
+  bool try_lock_shared() { return readerShard().mtx.try_lock_shared(); }
+  void unlock_shared() { readerShard().mtx.unlock_shared(); }
+
+  size_t shardCount() const noexcept { return _mask + 1; }
+};
+
+} // namespace PeakStore
+} // namespace CinderPeak
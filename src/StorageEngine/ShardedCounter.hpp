@@ -0,0 +1,84 @@
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <thread>
+
+namespace CinderPeak {
+namespace PeakStore {
+
+// Small per-thread index for picking a shard. Threads get consecutive
+// slots, so a pool of N threads covers N shards.
+inline size_t threadSlot() noexcept {
+  static std::atomic<size_t> next{0};
+  thread_local const size_t slot = next.fetch_add(1, std::memory_order_relaxed);
+  return slot;
+}
+
+// Power of two at least threads, capped at maxShards.
+inline size_t shardCountFor(size_t threads, size_t maxShards) noexcept {
+  size_t count = 1;
+  while (count < threads && count < maxShards)
+    count <<= 1;
+  return count;
+}
+
+/**
+ * @brief Signed counter split into cache-line padded atomic cells.
+ *
+ * add() is one relaxed fetch_add on the calling thread's cell, so writers
+ * on different threads never share a cache line or a lock. load() sums the
+ * cells with relaxed loads and clamps at zero. It is exact only when no
+ * add() runs concurrently; otherwise it is an approximation that need not
+ * equal any value the counter actually held.
+ * A counter built with one shard is a plain atomic.
+ */
+class ShardedCounter {
+  static constexpr size_t MAX_SHARDS = 16;
+
+  struct alignas(64) Cell {
+    std::atomic<int64_t> value{0};
+  };
+
+  std::unique_ptr<Cell[]> _cells;
+  size_t _mask;
+
+public:
+  ShardedCounter()
+      : ShardedCounter(
+            std::max<size_t>(1, std::thread::hardware_concurrency())) {}
+
+  explicit ShardedCounter(size_t threads)
+      : _cells(std::make_unique<Cell[]>(shardCountFor(threads, MAX_SHARDS))),
+        _mask(shardCountFor(threads, MAX_SHARDS) - 1) {}
+
+  ShardedCounter(const ShardedCounter &) = delete;
+  ShardedCounter &operator=(const ShardedCounter &) = delete;
+
+  void add(int64_t delta) noexcept {
+    _cells[threadSlot() & _mask].value.fetch_add(delta,
+                                                 std::memory_order_relaxed);
+  }
+
+  size_t load() const noexcept {
+    int64_t sum = 0;
+    for (size_t i = 0; i <= _mask; ++i)
+      sum += _cells[i].value.load(std::memory_order_relaxed);
+    return sum > 0 ? static_cast<size_t>(sum) : 0;
+  }
+
+  // Sets the counter to value. Adds racing with it may or may not survive.
+  void store(size_t value) noexcept {
+    for (size_t i = 1; i <= _mask; ++i)
+      _cells[i].value.store(0, std::memory_order_relaxed);
+    _cells[0].value.store(static_cast<int64_t>(value),
+                          std::memory_order_relaxed);
+  }
+
+  size_t shardCount() const noexcept { return _mask + 1; }
+};
+
+} // namespace PeakStore
+} // namespace CinderPeak
@@ -0,0 +1,279 @@
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace CinderPeak {
+namespace PeakStore {
+
+/**
+ * @brief Vector with N elements of inline storage.
+ *
+ * Holds up to N elements inside the object itself and only spills to the
+ * heap once the size exceeds N. Used for adjacency rows, where most vertices
+ * have a handful of neighbors: a low-degree row then costs no allocation and
+ * no pointer chase.
+ *
+ * Iterators are raw pointers and, like std::vector's, are invalidated by any
+ * operation that grows the container. Size and capacity are 32-bit to keep
+ * the header at 16 bytes.
+ *
+ * Spilled buffers come from Allocator. The allocator is fixed at
+ * construction and never propagated on assignment, which is what
+ * std::pmr::polymorphic_allocator expects.
+ *
+ * @tparam T Element type.
+ * @tparam N Number of inline slots (must be > 0).
+ * @tparam Allocator Allocator for spilled buffers.
+ */
+template <typename T, size_t N, typename Allocator = std::allocator<T>>
+class SmallVector : private Allocator {
+  static_assert(N > 0, "SmallVector needs at least one inline slot");
+  using AllocTraits = std::allocator_traits<Allocator>;
+
+public:
+  using allocator_type = Allocator;
+  using value_type = T;
+  using size_type = size_t;
+  using difference_type = std::ptrdiff_t;
+  using reference = T &;
+  using const_reference = const T &;
+  using pointer = T *;
+  using const_pointer = const T *;
+  using iterator = T *;
+  using const_iterator = const T *;
+
+  static constexpr size_t inline_capacity = N;
+
+  SmallVector() noexcept(noexcept(Allocator())) : SmallVector(Allocator()) {}
+
+  explicit SmallVector(const Allocator &alloc) noexcept
+      : Allocator(alloc), _data(inlineData()), _size(0), _capacity(N) {}
+
+  SmallVector(std::initializer_list<T> init,
+              const Allocator &alloc = Allocator())
+      : SmallVector(alloc) {
+    assign(init.begin(), init.end());
+  }
+
+  SmallVector(const SmallVector &other)
+      : SmallVector(
+            AllocTraits::select_on_container_copy_construction(other.alloc())) {
+    assign(other.begin(), other.end());
+  }
+
+  SmallVector(const SmallVector &other, const Allocator &alloc)
+      : SmallVector(alloc) {
+    assign(other.begin(), other.end());
+  }
+
+  SmallVector(SmallVector &&other) noexcept(
+      std::is_nothrow_move_constructible_v<T>)
+      : SmallVector(other.alloc()) {
+    takeFrom(std::move(other));
+  }
+
+  SmallVector(SmallVector &&other, const Allocator &alloc)
+      : SmallVector(alloc) {
+    moveFrom(std::move(other));
+  }
+
+  ~SmallVector() {
+    destroyRange(begin(), end());
+    releaseHeap();
+  }
+
+  SmallVector &operator=(const SmallVector &other) {
+    if (this != &other)
+      assign(other.begin(), other.end());
+    return *this;
+  }
+
+  SmallVector &operator=(SmallVector &&other) {
+    if (this != &other) {
+      clear();
+      releaseHeap();
+      moveFrom(std::move(other));
+    }
+    return *this;
+  }
+
+  allocator_type get_allocator() const noexcept { return alloc(); }
+
+  template <typename InputIt> void assign(InputIt first, InputIt last) {
+    clear();
+    reserve(static_cast<size_t>(std::distance(first, last)));
+    for (; first != last; ++first)
+      ::new (static_cast<void *>(_data + _size++)) T(*first);
+  }
+
+  iterator begin() noexcept { return _data; }
+  iterator end() noexcept { return _data + _size; }
+  const_iterator begin() const noexcept { return _data; }
+  const_iterator end() const noexcept { return _data + _size; }
+  const_iterator cbegin() const noexcept { return _data; }
+  const_iterator cend() const noexcept { return _data + _size; }
+
+  T *data() noexcept { return _data; }
+  const T *data() const noexcept { return _data; }
+
+  size_t size() const noexcept { return _size; }
+  size_t capacity() const noexcept { return _capacity; }
+  bool empty() const noexcept { return _size == 0; }
+
+  // True while the elements live in the inline buffer.
+  bool isInline() const noexcept { return _data == inlineData(); }
+
+  T &operator[](size_t i) noexcept { return _data[i]; }
+  const T &operator[](size_t i) const noexcept { return _data[i]; }
+  T &front() noexcept { return _data[0]; }
+  const T &front() const noexcept { return _data[0]; }
+  T &back() noexcept { return _data[_size - 1]; }
+  const T &back() const noexcept { return _data[_size - 1]; }
+
+  void reserve(size_t n) {
+    if (n > _capacity)
+      grow(n);
+  }
+
+  template <typename... Args> T &emplace_back(Args &&...args) {
+    if (_size == _capacity) {
+      // Construct first: args may alias an element that grow() would move.
+      T tmp(std::forward<Args>(args)...);
+      grow(static_cast<size_t>(_capacity) * 2);
+      ::new (static_cast<void *>(_data + _size)) T(std::move(tmp));
+    } else {
+      ::new (static_cast<void *>(_data + _size))
+          T(std::forward<Args>(args)...);
+    }
+    return _data[_size++];
+  }
+
+  void push_back(const T &value) { emplace_back(value); }
+  void push_back(T &&value) { emplace_back(std::move(value)); }
+
+  void pop_back() noexcept {
+    --_size;
+    _data[_size].~T();
+  }
+
+  iterator erase(const_iterator pos) { return erase(pos, pos + 1); }
+
+  iterator erase(const_iterator first, const_iterator last) {
+    iterator f = _data + (first - _data);
+    iterator l = _data + (last - _data);
+    if (f == l)
+      return f;
+    iterator new_end = std::move(l, end(), f);
+    destroyRange(new_end, end());
+    _size = static_cast<uint32_t>(new_end - _data);
+    return f;
+  }
+
+  void clear() noexcept {
+    destroyRange(begin(), end());
+    _size = 0;
+  }
+
+  // Moves heap-spilled elements back inline when they fit again.
+  void shrink_to_fit() {
+    if (isInline() || _size > N)
+      return;
+    T *heap = _data;
+    size_t heap_capacity = _capacity;
+    _data = inlineData();
+    uninitializedMove(heap, heap + _size, _data);
+    destroyRange(heap, heap + _size);
+    AllocTraits::deallocate(alloc(), heap, heap_capacity);
+    _capacity = N;
+  }
+
+  friend bool operator==(const SmallVector &a, const SmallVector &b) {
+    return a.size() == b.size() && std::equal(a.begin(), a.end(), b.begin());
+  }
+  friend bool operator!=(const SmallVector &a, const SmallVector &b) {
+    return !(a == b);
+  }
+
+private:
+  T *_data;
+  uint32_t _size;
+  uint32_t _capacity;
+  alignas(T) unsigned char _inline[N * sizeof(T)];
+
+  Allocator &alloc() noexcept { return *this; }
+  const Allocator &alloc() const noexcept { return *this; }
+
+  T *inlineData() noexcept { return reinterpret_cast<T *>(_inline); }
+  const T *inlineData() const noexcept {
+    return reinterpret_cast<const T *>(_inline);
+  }
+
+  static void destroyRange(T *first, T *last) noexcept {
+    if constexpr (!std::is_trivially_destructible_v<T>) {
+      for (; first != last; ++first)
+        first->~T();
+    }
+  }
+
+  static void uninitializedMove(T *first, T *last, T *dest) {
+    for (; first != last; ++first, ++dest)
+      ::new (static_cast<void *>(dest)) T(std::move_if_noexcept(*first));
+  }
+
+  void grow(size_t min_capacity) {
+    size_t new_capacity = std::max(min_capacity, N * 2);
+    T *heap = AllocTraits::allocate(alloc(), new_capacity);
+    uninitializedMove(_data, _data + _size, heap);
+    destroyRange(_data, _data + _size);
+    releaseHeap();
+    _data = heap;
+    _capacity = static_cast<uint32_t>(new_capacity);
+  }
+
+  void releaseHeap() noexcept {
+    if (!isInline()) {
+      AllocTraits::deallocate(alloc(), _data, _capacity);
+      _data = inlineData();
+      _capacity = N;
+    }
+  }
+
+  // Precondition: *this is empty and inline, and shares other's allocator.
+  void takeFrom(SmallVector &&other) {
+    if (other.isInline()) {
+      uninitializedMove(other.begin(), other.end(), inlineData());
+      _size = other._size;
+      other.clear();
+    } else {
+      _data = other._data;
+      _size = other._size;
+      _capacity = other._capacity;
+      other._data = other.inlineData();
+      other._size = 0;
+      other._capacity = N;
+    }
+  }
+
+  // Like takeFrom(), but only steals a heap buffer when both sides share an
+  // allocator; otherwise the elements are moved one by one.
+  void moveFrom(SmallVector &&other) {
+    if (other.isInline() || alloc() != other.alloc()) {
+      reserve(other.size());
+      uninitializedMove(other.begin(), other.end(), _data);
+      _size = other._size;
+      other.clear();
+    } else {
+      takeFrom(std::move(other));
+    }
+  }
+};
+
+} // namespace PeakStore
+} // namespace CinderPeak
@@ -0,0 +1,102 @@
+#pragma once
+#include "StorageEngine/StringInterner.hpp"
+#include "StorageEngine/Utils.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace CinderPeak {
+namespace PeakStore {
+
+/**
+ * @brief Vertex-to-id mappings saved by a snapshot.
+ *
+ * find() returns the saved mapping of v, or nullptr if none was saved.
+ */
+template <typename VertexType> class SnapshotIds {
+private:
+  std::unordered_map<VertexType, std::optional<VertexId>,
+                     VertexHasher<VertexType>, VertexEqual<VertexType>>
+      _ids;
+
+public:
+  bool empty() const noexcept { return _ids.empty(); }
+
+  const std::optional<VertexId> *find(const VertexType &v) const {
+    auto it = _ids.find(v);
+    return it == _ids.end() ? nullptr : &it->second;
+  }
+
+  // Keeps the first mapping saved for v.
+  void save(const VertexType &v, std::optional<VertexId> id) {
+    _ids.try_emplace(v, id);
+  }
+};
+
+/**
+ * @brief std::string specialization keyed by the snapshot's own interner,
+ * so lookups by string_view do not allocate.
+ *
+ * The storage's InternIds are not reused here: clear() and compactIds()
+ * release them while detached snapshots still need their saved names.
+ */
+template <> class SnapshotIds<std::string> {
+private:
+  StringInterner _names;
+  std::vector<std::optional<VertexId>> _ids; // indexed by InternId
+
+public:
+  bool empty() const noexcept { return _ids.empty(); }
+
+  const std::optional<VertexId> *find(std::string_view v) const {
+    auto key = _names.find(v);
+    return key ? &_ids[*key] : nullptr;
+  }
+
+  void save(std::string_view v, std::optional<VertexId> id) {
+    if (_names.find(v))
+      return;
+    _names.intern(v);
+    _ids.push_back(id);
+  }
+};
+
+/**
+ * @brief Undo state of one open snapshot of an AdjacencyList.
+ *
+ * A snapshot does not copy the graph when it is opened. Instead, before a
+ * writer changes a row, a vertex slot or a vertex-to-id mapping for the
+ * first time after the snapshot was taken, it saves the old value here
+ * (std::nullopt meaning "did not exist yet"). A reader resolves every item
+ * from this state first and falls back to the live storage otherwise; an
+ * item without a saved entry has not changed since the snapshot.
+ *
+ * Writers fill the maps under the storage's writer lock and readers consult
+ * them under its reader lock, so the state needs no mutex of its own. It is
+ * freed, together with every saved copy, when the last handle drops it.
+ */
+template <typename VertexType, typename EdgeType> struct SnapshotState {
+  using Neighbor = std::pair<VertexId, EdgeType>;
+  using Row = std::vector<Neighbor>;
+
+  // Sequence number of the snapshot within its storage (1, 2, ...).
+  uint64_t sequence = 0;
+  size_t num_vertices = 0;
+  // Stored directions, counted like GraphInternalMetadata::numEdges.
+  size_t num_edges = 0;
+  // Set when a bulk rewrite (clear, compactIds, bulkLoad) copied every live
+  // item in. Reads then never touch the live storage.
+  bool detached = false;
+
+  std::unordered_map<VertexId, std::optional<Row>> rows;
+  std::unordered_map<VertexId, std::optional<VertexType>> vertices;
+  SnapshotIds<VertexType> ids;
+};
+
+} // namespace PeakStore
+} // namespace CinderPeak
@@ -0,0 +1,150 @@
+#pragma once
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <memory_resource>
+#include <optional>
+#include <string_view>
+#include <utility>
+#include <unordered_map>
+#include <vector>
+
+namespace CinderPeak {
+namespace PeakStore {
+
+using InternId = uint32_t;
+
+/**
+ * @brief Arena-backed string interner.
+ *
+ * Every distinct string is copied exactly once into a contiguous block arena
+ * and identified by a dense InternId. The lookup table is keyed on
+ * std::string_view pointing into the arena, so queries never allocate.
+ *
+ * Interned bytes are never released individually; they live until clear().
+ * Arena blocks and lookup tables are allocated from the memory resource
+ * passed at construction.
+ *
+ * @note Not thread-safe. Owners are expected to guard it with their own lock.
+ */
+class StringInterner {
+private:
+  static constexpr size_t BLOCK_SIZE = 64 * 1024;
+  // Strings larger than this get a dedicated block so they do not waste the
+  // remaining space of the current one.
+  static constexpr size_t LARGE_STRING = BLOCK_SIZE / 4;
+
+  // Owning handle for one arena block; returns it to its resource on
+  // destruction.
+  struct Block {
+    std::pmr::memory_resource *resource;
+    char *data;
+    size_t size;
+
+    Block(std::pmr::memory_resource *mr, size_t n)
+        : resource(mr), data(static_cast<char *>(mr->allocate(n, 1))),
+          size(n) {}
+    Block(Block &&other) noexcept
+        : resource(other.resource), data(std::exchange(other.data, nullptr)),
+          size(other.size) {}
+    Block &operator=(Block &&other) noexcept {
+      std::swap(resource, other.resource);
+      std::swap(data, other.data);
+      std::swap(size, other.size);
+      return *this;
+    }
+    Block(const Block &) = delete;
+    Block &operator=(const Block &) = delete;
+    ~Block() {
+      if (data)
+        resource->deallocate(data, size, 1);
+    }
+  };
+
+  std::pmr::memory_resource *_resource;
+  std::pmr::vector<Block> _blocks;
+  char *_cursor = nullptr;
+  size_t _remaining = 0;
+  size_t _bytes_reserved = 0;
+
+  std::pmr::vector<std::string_view> _views;
+  std::pmr::unordered_map<std::string_view, InternId> _ids;
+
+  std::string_view store(std::string_view s) {
+    if (s.empty())
+      return std::string_view{};
+
+    if (s.size() > LARGE_STRING) {
+      _blocks.emplace_back(_resource, s.size());
+      _bytes_reserved += s.size();
+      std::memcpy(_blocks.back().data, s.data(), s.size());
+      return std::string_view(_blocks.back().data, s.size());
+    }
+
+    if (s.size() > _remaining) {
+      _blocks.emplace_back(_resource, BLOCK_SIZE);
+      _bytes_reserved += BLOCK_SIZE;
+      _cursor = _blocks.back().data;
+      _remaining = BLOCK_SIZE;
+    }
+
+    char *dst = _cursor;
+    std::memcpy(dst, s.data(), s.size());
+    _cursor += s.size();
+    _remaining -= s.size();
+    return std::string_view(dst, s.size());
+  }
+
+public:
+  explicit StringInterner(
+      std::pmr::memory_resource *resource = std::pmr::get_default_resource())
+      : _resource(resource), _blocks(resource), _views(resource),
+        _ids(resource) {}
+  StringInterner(const StringInterner &) = delete;
+  StringInterner &operator=(const StringInterner &) = delete;
+  StringInterner(StringInterner &&) noexcept = default;
+  StringInterner &operator=(StringInterner &&) = default;
+
+  // Returns the id of s, copying it into the arena on first sight.
+  InternId intern(std::string_view s) {
+    if (auto it = _ids.find(s); it != _ids.end())
+      return it->second;
+
+    std::string_view stored = store(s);
+    auto id = static_cast<InternId>(_views.size());
+    _views.push_back(stored);
+    _ids.emplace(stored, id);
+    return id;
+  }
+
+  std::optional<InternId> find(std::string_view s) const {
+    auto it = _ids.find(s);
+    if (it == _ids.end())
+      return std::nullopt;
+    return it->second;
+  }
+
+  std::string_view view(InternId id) const { return _views[id]; }
+
+  size_t size() const noexcept { return _views.size(); }
+
+  // Total arena capacity in bytes (excluding lookup table overhead).
+  size_t bytesReserved() const noexcept { return _bytes_reserved; }
+
+  void reserve(size_t n) {
+    _views.reserve(n);
+    _ids.reserve(n);
+  }
+
+  void clear() {
+    _ids.clear();
+    _views.clear();
+    _blocks.clear();
+    _cursor = nullptr;
+    _remaining = 0;
+    _bytes_reserved = 0;
+  }
+};
+
+} // namespace PeakStore
+} // namespace CinderPeak
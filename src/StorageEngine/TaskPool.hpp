@@ -0,0 +1,183 @@
+#pragma once
+#include <algorithm>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace CinderPeak {
+namespace PeakStore {
+
+// Most tasks a worker takes off the queue per lock acquisition.
+inline constexpr size_t TASK_POOL_BATCH = 32;
+
+/**
+ * @brief Fixed-size worker pool with a shared FIFO queue.
+ *
+ * Workers start on the first submission, so a pool that is never used costs
+ * no threads. Submissions are batched on both sides: a producer only wakes a
+ * worker when one is asleep, and a woken worker takes up to TASK_POOL_BATCH
+ * tasks (its fair share of the queue) per lock acquisition. Tasks submitted
+ * from the same thread start in submission order but may finish in any
+ * order when the pool has more than one worker.
+ *
+ * wait() and the destructor drain the queue first; neither may be called
+ * from a task running on the pool.
+ */
+class TaskPool {
+  using Task = std::function<void()>;
+
+  std::mutex _mtx;
+  std::condition_variable _work;
+  std::condition_variable _idle;
+  std::deque<Task> _queue;
+  std::vector<std::thread> _workers;
+  size_t _threads;
+  size_t _active = 0;
+  size_t _sleeping = 0;
+  bool _stopping = false;
+  // Set while a generation of workers drains and exits. post() then only
+  // queues, so no new generation can start (and clear _stopping) before
+  // the old one is joined.
+  bool _resizing = false;
+
+  static size_t defaultThreads() {
+    return std::max<size_t>(1, std::thread::hardware_concurrency());
+  }
+
+  void startWorkers_nolock() {
+    _workers.reserve(_threads);
+    for (size_t i = 0; i < _threads; ++i)
+      _workers.emplace_back([this] { workerLoop(); });
+  }
+
+  // Joins the current workers once they finish the batch they hold, then
+  // switches to threads workers (0 keeps the count). Tasks still queued,
+  // including ones posted meanwhile, start the next generation.
+  void stopWorkers(size_t threads = 0) {
+    std::vector<std::thread> workers;
+    {
+      std::unique_lock<std::mutex> lock(_mtx);
+      _idle.wait(lock, [this] { return !_resizing; });
+      _resizing = true;
+      _stopping = true;
+      workers.swap(_workers);
+    }
+    _work.notify_all();
+    for (auto &worker : workers)
+      worker.join();
+    {
+      std::lock_guard<std::mutex> lock(_mtx);
+      _stopping = false;
+      _resizing = false;
+      if (threads)
+        _threads = threads;
+      if (!_queue.empty())
+        startWorkers_nolock();
+    }
+    _idle.notify_all();
+  }
+
+  void workerLoop() {
+    std::vector<Task> batch;
+    batch.reserve(TASK_POOL_BATCH);
+    std::unique_lock<std::mutex> lock(_mtx);
+    for (;;) {
+      ++_sleeping;
+      _work.wait(lock, [this] { return _stopping || !_queue.empty(); });
+      --_sleeping;
+      if (_stopping)
+        return;
+
+      size_t share = (_queue.size() + _threads - 1) / _threads;
+      size_t take = std::min(share, TASK_POOL_BATCH);
+      for (size_t i = 0; i < take; ++i) {
+        batch.push_back(std::move(_queue.front()));
+        _queue.pop_front();
+      }
+      ++_active;
+      if (!_queue.empty() && _sleeping > 0)
+        _work.notify_one();
+      lock.unlock();
+
+      for (auto &task : batch) {
+        try {
+          task();
+        } catch (...) {
+          // Futures carry task errors; keep the worker alive regardless.
+        }
+      }
+      batch.clear();
+
+      lock.lock();
+      --_active;
+      if (_active == 0 && _queue.empty())
+        _idle.notify_all();
+    }
+  }
+
+public:
+  explicit TaskPool(size_t threads = 0)
+      : _threads(threads ? threads : defaultThreads()) {}
+
+  TaskPool(const TaskPool &) = delete;
+  TaskPool &operator=(const TaskPool &) = delete;
+
+  ~TaskPool() {
+    wait();
+    stopWorkers();
+  }
+
+  // Resizes the pool. Running tasks finish on the old workers; queued ones
+  // move to the new workers, which otherwise start with the next
+  // submission. 0 picks one per hardware thread.
+  void setThreads(size_t threads) {
+    stopWorkers(threads ? threads : defaultThreads());
+  }
+
+  size_t threads() {
+    std::lock_guard<std::mutex> lock(_mtx);
+    return _threads;
+  }
+
+  void post(Task task) {
+    bool wake;
+    {
+      std::lock_guard<std::mutex> lock(_mtx);
+      if (_workers.empty() && !_resizing)
+        startWorkers_nolock();
+      _queue.push_back(std::move(task));
+      wake = _sleeping > 0;
+    }
+    if (wake)
+      _work.notify_one();
+  }
+
+  // Runs fn on the pool; its result or exception arrives through the
+  // future.
+  template <typename Fn>
+  std::future<std::invoke_result_t<std::decay_t<Fn> &>> submit(Fn &&fn) {
+    using Result = std::invoke_result_t<std::decay_t<Fn> &>;
+    auto task =
+        std::make_shared<std::packaged_task<Result()>>(std::forward<Fn>(fn));
+    auto future = task->get_future();
+    post([task] { (*task)(); });
+    return future;
+  }
+
+  // Blocks until the queue is empty and no task is running.
+  void wait() {
+    std::unique_lock<std::mutex> lock(_mtx);
+    _idle.wait(lock, [this] { return _queue.empty() && _active == 0; });
+  }
+};
+
+} // namespace PeakStore
+} // namespace CinderPeak
@@ -11,10 +11,12 @@
 #include <iostream>
 #include <map>
 #include <memory>
+#include <memory_resource>
 #include <optional>
 #include <random>
 #include <sstream>
 #include <string>
+#include <string_view>
 #include <type_traits>
 #include <unordered_map>
 #include <utility>
@@ -24,6 +26,15 @@ namespace CinderPeak {
 
 using VertexId = uint64_t;
 
+// Converts between VertexId and size_t. Casts only where the two differ
+// (32-bit targets), so 64-bit builds see no useless cast.
+template <typename To, typename From> constexpr To idCast(From value) {
+  if constexpr (std::is_same_v<To, From>)
+    return value;
+  else
+    return static_cast<To>(value);
+}
+
 class GraphCreationOptions {
 public:
   enum GraphType { Directed = 0, Undirected };
@@ -40,24 +51,70 @@ public:
 
   bool hasOption(GraphType type) const { return options.test(type); }
 
+  // Memory resource the graph's storages and context allocate from. It must
+  // outlive the graph; with a std::pmr::monotonic_buffer_resource the whole
+  // graph can be released at once by releasing the arena.
+  GraphCreationOptions &setMemoryResource(std::pmr::memory_resource *mr) {
+    resource = mr;
+    return *this;
+  }
+
+  std::pmr::memory_resource *memoryResource() const {
+    return resource ? resource : std::pmr::get_default_resource();
+  }
+
 private:
   std::bitset<8> options;
+  std::pmr::memory_resource *resource = nullptr;
+};
+
+// The add-edge rules. PeakStorageInterface::impl_addEdgeChecked and
+// impl_addEdgePair enforce them under the storage lock, on top of "both
+// vertices exist" and "no self loop"; batches and bulk loads use the same
+// struct.
+struct EdgeInsertRules {
+  // An existing src->dest edge only conflicts if its weight is equal.
+  bool weighted = false;
+  // When false, an existing dest->src edge conflicts as well.
+  bool directed = true;
 };
 
 // Forward declaration of hashers
 template <typename T, typename Enable = void> struct VertexHasher;
 template <typename T, typename Enable = void> struct EdgeHasher;
 
-// Primitive or std::string hashing - uses std::hash
+// Primitive hashing - uses std::hash
 template <typename T>
-struct VertexHasher<
-    T, std::enable_if_t<std::is_integral_v<T> || std::is_floating_point_v<T> ||
-                        std::is_same_v<T, std::string>>> {
+struct VertexHasher<T, std::enable_if_t<std::is_integral_v<T> ||
+                                        std::is_floating_point_v<T>>> {
   std::size_t operator()(const T &v) const noexcept {
     return std::hash<T>{}(v);
   }
 };
 
+// std::string hashing. Transparent: std::string, std::string_view and
+// const char* all hash identically, so containers supporting heterogeneous
+// lookup can be queried without building a temporary std::string.
+template <typename T>
+struct VertexHasher<T, std::enable_if_t<std::is_same_v<T, std::string>>> {
+  using is_transparent = void;
+  std::size_t operator()(std::string_view v) const noexcept {
+    return std::hash<std::string_view>{}(v);
+  }
+};
+
+// Vertex equality. Transparent for std::string, to pair with VertexHasher.
+template <typename T> struct VertexEqual : std::equal_to<T> {};
+template <> struct VertexEqual<std::string> : std::equal_to<> {};
+
+// Parameter type of read-only vertex lookups (hasVertex, getEdge,
+// getNeighbors, ...). String vertices are looked up by std::string_view so a
+// caller holding a view or a C string does not allocate per query.
+template <typename T>
+using VertexLookupKey =
+    std::conditional_t<std::is_same_v<T, std::string>, std::string_view,
+                       const T &>;
+
 // Helper to detect __id_ member for user-defined types
 template <typename, typename = void> struct has___id : std::false_type {};
 template <typename T>
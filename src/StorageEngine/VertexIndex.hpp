@@ -0,0 +1,156 @@
+#pragma once
+#include "StringInterner.hpp"
+#include "Utils.hpp"
+#include <limits>
+#include <memory_resource>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace CinderPeak {
+namespace PeakStore {
+
+/**
+ * @brief Maps user vertex values to a storage's internal ids.
+ *
+ * Storages keep a `key_type` per internal id (instead of a full VertexType)
+ * and turn it back into a vertex value through value(). For most vertex
+ * types key_type is VertexType itself and this is a plain hash map.
+ *
+ * All index memory comes from the memory resource passed at construction.
+ *
+ * @tparam VertexType User vertex type.
+ * @tparam IdType Internal id type of the owning storage.
+ */
+template <typename VertexType, typename IdType> class VertexIndex {
+private:
+  std::pmr::unordered_map<VertexType, IdType, VertexHasher<VertexType>,
+                          VertexEqual<VertexType>>
+      _lookup;
+
+public:
+  using key_type = VertexType;
+
+  explicit VertexIndex(
+      std::pmr::memory_resource *resource = std::pmr::get_default_resource())
+      : _lookup(resource) {}
+
+  std::optional<IdType> find(const VertexType &v) const {
+    auto it = _lookup.find(v);
+    if (it == _lookup.end())
+      return std::nullopt;
+    return it->second;
+  }
+
+  bool contains(const VertexType &v) const {
+    return _lookup.find(v) != _lookup.end();
+  }
+
+  // Registers a vertex that is not yet present and returns its key.
+  key_type insert(const VertexType &v, IdType id) {
+    _lookup.try_emplace(v, id);
+    return v;
+  }
+
+  // Re-points an existing key at a new id (used when ids are compacted).
+  void assign(const key_type &key, IdType id) { _lookup[key] = id; }
+
+  void erase(const key_type &key) { _lookup.erase(key); }
+
+  const VertexType &value(const key_type &key) const { return key; }
+
+  size_t size() const noexcept { return _lookup.size(); }
+
+  void reserve(size_t n) { _lookup.reserve(n); }
+
+  // Forgets every id assignment. Keys handed out earlier stay valid.
+  void resetIds() { _lookup.clear(); }
+
+  void clear() { _lookup.clear(); }
+};
+
+/**
+ * @brief std::string specialization backed by a StringInterner.
+ *
+ * Each vertex name is stored once in the interner's arena; storages keep the
+ * 4-byte InternId as their per-vertex key. Lookups hash a string_view, so
+ * querying with a std::string, string_view or const char* never allocates.
+ *
+ * Names of removed vertices stay interned (and are reused if the vertex is
+ * added again) until clear() releases the arena. Storages that compact
+ * their ids rebuild the index from the live vertices, which drops them.
+ */
+template <typename IdType> class VertexIndex<std::string, IdType> {
+private:
+  static constexpr IdType NO_ID = std::numeric_limits<IdType>::max();
+
+  StringInterner _strings;
+  std::pmr::vector<IdType> _ids; // indexed by InternId
+  size_t _live = 0;
+
+public:
+  using key_type = InternId;
+
+  explicit VertexIndex(
+      std::pmr::memory_resource *resource = std::pmr::get_default_resource())
+      : _strings(resource), _ids(resource) {}
+
+  std::optional<IdType> find(std::string_view v) const {
+    auto key = _strings.find(v);
+    if (!key || _ids[*key] == NO_ID)
+      return std::nullopt;
+    return _ids[*key];
+  }
+
+  bool contains(std::string_view v) const { return find(v).has_value(); }
+
+  key_type insert(std::string_view v, IdType id) {
+    InternId key = _strings.intern(v);
+    if (key >= _ids.size())
+      _ids.resize(static_cast<size_t>(key) + 1, NO_ID);
+    if (_ids[key] == NO_ID)
+      ++_live;
+    _ids[key] = id;
+    return key;
+  }
+
+  void assign(key_type key, IdType id) {
+    if (_ids[key] == NO_ID)
+      ++_live;
+    _ids[key] = id;
+  }
+
+  void erase(key_type key) {
+    if (_ids[key] != NO_ID) {
+      _ids[key] = NO_ID;
+      --_live;
+    }
+  }
+
+  std::string_view value(key_type key) const { return _strings.view(key); }
+
+  size_t size() const noexcept { return _live; }
+
+  void reserve(size_t n) {
+    _strings.reserve(n);
+    _ids.reserve(n);
+  }
+
+  void resetIds() {
+    std::fill(_ids.begin(), _ids.end(), NO_ID);
+    _live = 0;
+  }
+
+  void clear() {
+    _strings.clear();
+    _ids.clear();
+    _live = 0;
+  }
+
+  const StringInterner &interner() const noexcept { return _strings; }
+};
+
+} // namespace PeakStore
+} // namespace CinderPeak
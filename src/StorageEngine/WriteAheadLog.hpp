@@ -0,0 +1,588 @@
+#pragma once
+#include "Operations/WriteBatch.hpp"
+#include "StorageEngine/ErrorCodes.hpp"
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#if defined(_WIN32)
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+namespace CinderPeak {
+
+/**
+ * @brief Byte encoding of vertex and edge values in the write-ahead log.
+ *
+ * Trivially copyable types are stored as raw bytes (empty ones, such as
+ * Unweighted, take none) and std::string is length-prefixed. Specialize
+ * WalCodec for other types; a graph whose types have no codec cannot
+ * enable a log. size() is the number of bytes encode() appends.
+ */
+template <typename T, typename Enable = void> struct WalCodec {
+  static constexpr bool supported = false;
+};
+
+template <typename T>
+struct WalCodec<T, std::enable_if_t<std::is_trivially_copyable_v<T>>> {
+  static constexpr bool supported = true;
+
+  static size_t size(const T &) {
+    return std::is_empty_v<T> ? 0 : sizeof(T);
+  }
+
+  static void encode(std::string &out, const T &value) {
+    if constexpr (!std::is_empty_v<T>)
+      out.append(reinterpret_cast<const char *>(&value), sizeof(T));
+  }
+
+  static bool decode(const char *&pos, const char *end, T &value) {
+    if constexpr (!std::is_empty_v<T>) {
+      if (static_cast<size_t>(end - pos) < sizeof(T))
+        return false;
+      std::memcpy(&value, pos, sizeof(T));
+      pos += sizeof(T);
+    }
+    return true;
+  }
+};
+
+template <> struct WalCodec<std::string> {
+  static constexpr bool supported = true;
+
+  static size_t size(const std::string &value) {
+    return sizeof(uint32_t) + value.size();
+  }
+
+  // Callers keep value below 4 GiB; WalFrameWriter rejects larger ops
+  // before encoding them.
+  static void encode(std::string &out, const std::string &value) {
+    WalCodec<uint32_t>::encode(out, static_cast<uint32_t>(value.size()));
+    out.append(value);
+  }
+
+  static bool decode(const char *&pos, const char *end, std::string &value) {
+    uint32_t size = 0;
+    if (!WalCodec<uint32_t>::decode(pos, end, size) ||
+        static_cast<size_t>(end - pos) < size)
+      return false;
+    value.assign(pos, size);
+    pos += size;
+    return true;
+  }
+};
+
+// When the log forces its records to disk.
+enum class WalSyncPolicy : uint8_t {
+  // Every mutation waits until its record is on disk. Writers that arrive
+  // while a sync is running share the next one (group commit).
+  PerOp,
+  // The writer whose record makes syncEveryOps records pending syncs them
+  // all; a crash loses at most that many.
+  EveryNOps,
+  // A background thread syncs every syncInterval; a crash loses at most
+  // one interval of writes.
+  EveryInterval
+};
+
+struct WalOptions {
+  WalSyncPolicy policy = WalSyncPolicy::PerOp;
+  size_t syncEveryOps = 64;
+  std::chrono::milliseconds syncInterval{10};
+  // Bulk loads and batches are logged as several Ops frames whose bodies
+  // stay within this many bytes. Values above UINT32_MAX are clamped.
+  size_t maxFrameBytes = std::numeric_limits<uint32_t>::max();
+};
+
+/**
+ * @brief Binary framing of log records.
+ *
+ * A frame is [u32 body size][u32 FNV-1a of body][body]. A body is a tag
+ * byte, then for Ops a u32 count followed by that many operations, each
+ * a BatchOpKind byte and its operands (src; src, dest; or src, dest,
+ * weight). A single mutation is an Ops record of one operation, so replay
+ * goes through PeakStore::apply like any WriteBatch.
+ *
+ * An operation that would push the body past the writer's limit is not
+ * written; finish() then returns an empty string, which WalTransaction
+ * reports as an error instead of logging a wrapped length.
+ */
+enum class WalRecordTag : uint8_t { Ops, ClearEdges, ClearVertices };
+
+inline uint32_t walChecksum(const char *data, size_t size) {
+  uint32_t hash = 2166136261u;
+  for (size_t i = 0; i < size; ++i) {
+    hash ^= static_cast<unsigned char>(data[i]);
+    hash *= 16777619u;
+  }
+  return hash;
+}
+
+template <typename VertexType, typename EdgeType> class WalFrameWriter {
+  using VertexCodec = WalCodec<VertexType>;
+  using EdgeCodec = WalCodec<EdgeType>;
+  static constexpr size_t HEADER = 2 * sizeof(uint32_t);
+  static constexpr size_t COUNT_AT = HEADER + 1;
+
+  std::string _frame;
+  uint32_t _count = 0;
+  size_t _max_body;
+  bool _overflow = false;
+
+public:
+  // The header stores the body size as a u32.
+  static constexpr size_t MAX_BODY = std::numeric_limits<uint32_t>::max();
+
+  explicit WalFrameWriter(WalRecordTag tag, size_t max_body = MAX_BODY)
+      : _max_body(std::min(max_body, MAX_BODY)) {
+    _frame.assign(HEADER, '\0');
+    _frame.push_back(static_cast<char>(tag));
+    if (tag == WalRecordTag::Ops)
+      WalCodec<uint32_t>::encode(_frame, 0);
+  }
+
+  // Encoded size of one operation, as op() would write it.
+  static size_t opSize(BatchOpKind kind, const VertexType &src,
+                       const VertexType &dest = VertexType(),
+                       const EdgeType &weight = EdgeType()) {
+    size_t bytes = 1;
+    if constexpr (VertexCodec::supported && EdgeCodec::supported) {
+      bytes += VertexCodec::size(src);
+      if (kind != BatchOpKind::AddVertex && kind != BatchOpKind::RemoveVertex)
+        bytes += VertexCodec::size(dest);
+      if (kind == BatchOpKind::AddEdge || kind == BatchOpKind::UpdateEdge)
+        bytes += EdgeCodec::size(weight);
+    }
+    return bytes;
+  }
+
+  // Whether another bytes of operations fit under the body limit.
+  bool fits(size_t bytes) const {
+    return bytes <= _max_body && _frame.size() - HEADER <= _max_body - bytes;
+  }
+
+  // dest and weight are written only for the kinds that carry them.
+  WalFrameWriter &op(BatchOpKind kind, const VertexType &src,
+                     const VertexType &dest = VertexType(),
+                     const EdgeType &weight = EdgeType()) {
+    ++_count;
+    if (!fits(opSize(kind, src, dest, weight))) {
+      _overflow = true;
+      return *this;
+    }
+    if constexpr (VertexCodec::supported && EdgeCodec::supported) {
+      _frame.push_back(static_cast<char>(kind));
+      VertexCodec::encode(_frame, src);
+      if (kind != BatchOpKind::AddVertex && kind != BatchOpKind::RemoveVertex)
+        VertexCodec::encode(_frame, dest);
+      if (kind == BatchOpKind::AddEdge || kind == BatchOpKind::UpdateEdge)
+        EdgeCodec::encode(_frame, weight);
+    }
+    return *this;
+  }
+
+  uint32_t count() const { return _count; }
+  bool overflowed() const { return _overflow; }
+
+  // Fills in the header and returns the finished frame, or an empty
+  // string if an operation did not fit.
+  std::string finish() {
+    if (_overflow)
+      return std::string();
+    if (_frame.size() > COUNT_AT)
+      std::memcpy(&_frame[COUNT_AT], &_count, sizeof(_count));
+    uint32_t size = static_cast<uint32_t>(_frame.size() - HEADER);
+    uint32_t sum = walChecksum(_frame.data() + HEADER, size);
+    std::memcpy(&_frame[0], &size, sizeof(size));
+    std::memcpy(&_frame[sizeof(size)], &sum, sizeof(sum));
+    return std::move(_frame);
+  }
+};
+
+/**
+ * @brief Append-only log file with group commit.
+ *
+ * append() only copies a frame into an in-memory buffer and hands back its
+ * log sequence number (LSN). commit() then applies the sync policy. The
+ * first writer that must wait becomes the leader: it takes the whole
+ * buffer, writes and fsyncs it without holding the buffer lock, and wakes
+ * every writer whose LSN that covered. Writers arriving meanwhile queue up
+ * for the next leader, so one fsync serves many mutations.
+ *
+ * I/O errors are sticky and reported by sync() and status().
+ */
+class WriteAheadLog {
+  std::FILE *_file = nullptr;
+  WalOptions _options;
+
+  // Held by writers across "storage change + append", so records are in
+  // the order the storage applied them.
+  std::mutex _order;
+
+  std::mutex _mtx;
+  std::condition_variable _durable_cv;
+  std::string _buffer;
+  uint64_t _appended = 0;
+  uint64_t _durable = 0;
+  bool _flushing = false;
+  PeakStatus _status = PeakStatus::OK();
+
+  std::thread _flusher;
+  std::condition_variable _stop_cv;
+  bool _stop = false;
+
+  PeakStatus writeAndSync(const std::string &bytes) {
+    if (!bytes.empty() &&
+        std::fwrite(bytes.data(), 1, bytes.size(), _file) != bytes.size())
+      return PeakStatus::InternalError("Write-ahead log write failed.");
+    if (std::fflush(_file) != 0)
+      return PeakStatus::InternalError("Write-ahead log flush failed.");
+#if defined(_WIN32)
+    if (_commit(_fileno(_file)) != 0)
+#else
+    if (fsync(fileno(_file)) != 0)
+#endif
+      return PeakStatus::InternalError("Write-ahead log fsync failed.");
+    return PeakStatus::OK();
+  }
+
+  void waitDurable(uint64_t lsn) {
+    std::unique_lock<std::mutex> lock(_mtx);
+    while (_durable < lsn) {
+      if (_flushing) {
+        _durable_cv.wait(lock);
+        continue;
+      }
+      _flushing = true;
+      std::string bytes;
+      bytes.swap(_buffer);
+      uint64_t upto = _appended;
+      lock.unlock();
+      PeakStatus status = writeAndSync(bytes);
+      lock.lock();
+      _flushing = false;
+      // Advance even on failure so writers do not wait forever; the error
+      // stays in _status.
+      _durable = upto;
+      if (!status.isOK() && _status.isOK())
+        _status = status;
+      _durable_cv.notify_all();
+    }
+  }
+
+  void flushLoop() {
+    std::unique_lock<std::mutex> lock(_mtx);
+    while (!_stop) {
+      _stop_cv.wait_for(lock, _options.syncInterval);
+      uint64_t upto = _appended;
+      lock.unlock();
+      waitDurable(upto);
+      lock.lock();
+    }
+  }
+
+public:
+  WriteAheadLog(std::FILE *file, const WalOptions &options)
+      : _file(file), _options(options) {
+    if (_options.policy == WalSyncPolicy::EveryInterval)
+      _flusher = std::thread([this] { flushLoop(); });
+  }
+
+  WriteAheadLog(const WriteAheadLog &) = delete;
+  WriteAheadLog &operator=(const WriteAheadLog &) = delete;
+
+  ~WriteAheadLog() {
+    if (_flusher.joinable()) {
+      {
+        std::lock_guard<std::mutex> lock(_mtx);
+        _stop = true;
+      }
+      _stop_cv.notify_all();
+      _flusher.join();
+    }
+    (void)sync();
+    std::fclose(_file);
+  }
+
+  // Opens (creating if needed) the log at path for appending.
+  static std::pair<std::unique_ptr<WriteAheadLog>, PeakStatus>
+  open(const std::string &path, const WalOptions &options = WalOptions()) {
+    std::FILE *file = std::fopen(path.c_str(), "ab");
+    if (!file)
+      return {nullptr, PeakStatus::InternalError(
+                           "Cannot open write-ahead log: " + path)};
+    return {std::make_unique<WriteAheadLog>(file, options), PeakStatus::OK()};
+  }
+
+  std::mutex &orderMutex() { return _order; }
+
+  const WalOptions &options() const { return _options; }
+
+  // Buffers one frame and returns its LSN. Nothing is written yet.
+  uint64_t append(std::string frame) {
+    std::lock_guard<std::mutex> lock(_mtx);
+    _buffer.append(frame);
+    return ++_appended;
+  }
+
+  // Makes lsn durable if the sync policy requires it now. Returns the
+  // sticky log status, so a failed fsync reaches the next committer even
+  // when a background or group flush hit it.
+  PeakStatus commit(uint64_t lsn) {
+    switch (_options.policy) {
+    case WalSyncPolicy::PerOp:
+      waitDurable(lsn);
+      break;
+    case WalSyncPolicy::EveryNOps: {
+      bool due = false;
+      {
+        std::lock_guard<std::mutex> lock(_mtx);
+        due = lsn >= _durable + _options.syncEveryOps;
+      }
+      if (due)
+        waitDurable(lsn);
+      break;
+    }
+    case WalSyncPolicy::EveryInterval:
+      break;
+    }
+    return status();
+  }
+
+  // Writes and fsyncs every appended record, whatever the policy.
+  PeakStatus sync() {
+    uint64_t upto = 0;
+    {
+      std::lock_guard<std::mutex> lock(_mtx);
+      upto = _appended;
+    }
+    waitDurable(upto);
+    return status();
+  }
+
+  PeakStatus status() {
+    std::lock_guard<std::mutex> lock(_mtx);
+    return _status;
+  }
+
+  // Records appended so far and records known to be on disk.
+  uint64_t appendedCount() {
+    std::lock_guard<std::mutex> lock(_mtx);
+    return _appended;
+  }
+  uint64_t durableCount() {
+    std::lock_guard<std::mutex> lock(_mtx);
+    return _durable;
+  }
+};
+
+/**
+ * @brief Orders one mutation against the log.
+ *
+ * Construct it before the storage call, record() the change once it
+ * succeeded and return commit()'s status. commit() releases the order lock
+ * and only then waits for durability, so writers queued behind one fsync
+ * can already apply their own changes. The destructor commits if an early
+ * return skipped it. Without a log it does nothing.
+ */
+class WalTransaction {
+  WriteAheadLog *_log;
+  std::unique_lock<std::mutex> _order;
+  uint64_t _lsn = 0;
+  PeakStatus _error = PeakStatus::OK();
+
+public:
+  explicit WalTransaction(WriteAheadLog *log) : _log(log) {
+    if (_log)
+      _order = std::unique_lock<std::mutex>(_log->orderMutex());
+  }
+
+  WalTransaction(const WalTransaction &) = delete;
+  WalTransaction &operator=(const WalTransaction &) = delete;
+
+  bool active() const { return _log != nullptr; }
+
+  size_t maxFrameBytes() const { return _log->options().maxFrameBytes; }
+
+  // An empty frame is one WalFrameWriter could not fit; nothing is logged
+  // and commit() reports it.
+  void record(std::string frame) {
+    if (frame.empty()) {
+      _error = PeakStatus::InvalidArgument(
+          "Operation is too large for a write-ahead log record.");
+      return;
+    }
+    _lsn = _log->append(std::move(frame));
+  }
+
+  // Releases the order lock and applies the sync policy to the recorded
+  // change. OK when nothing was recorded; later calls do nothing.
+  PeakStatus commit() {
+    if (_order.owns_lock())
+      _order.unlock();
+    uint64_t lsn = std::exchange(_lsn, 0);
+    PeakStatus status = lsn ? _log->commit(lsn) : PeakStatus::OK();
+    if (!_error.isOK())
+      return std::exchange(_error, PeakStatus::OK());
+    return status;
+  }
+
+  ~WalTransaction() { (void)commit(); }
+};
+
+/**
+ * @brief Logs a run of operations as Ops frames of bounded size.
+ *
+ * Starts a new frame whenever the next operation would take the body past
+ * the log's maxFrameBytes, so no frame length wraps however large the run.
+ * Replay applies the frames in order, which gives the same graph as one
+ * frame would.
+ */
+template <typename VertexType, typename EdgeType> class WalOpsRecorder {
+  using Frame = WalFrameWriter<VertexType, EdgeType>;
+  WalTransaction &_wal;
+  size_t _max_body;
+  Frame _frame;
+
+public:
+  explicit WalOpsRecorder(WalTransaction &wal)
+      : _wal(wal), _max_body(wal.maxFrameBytes()),
+        _frame(WalRecordTag::Ops, _max_body) {}
+
+  void op(BatchOpKind kind, const VertexType &src,
+          const VertexType &dest = VertexType(),
+          const EdgeType &weight = EdgeType()) {
+    if (_frame.count() > 0 &&
+        !_frame.fits(Frame::opSize(kind, src, dest, weight)))
+      flush();
+    _frame.op(kind, src, dest, weight);
+    // An operation too large for any frame fails the transaction; the
+    // ones around it are still logged.
+    if (_frame.overflowed())
+      flush();
+  }
+
+  // Records the pending frame, if it holds any operations.
+  void flush() {
+    if (_frame.count() > 0)
+      _wal.record(std::exchange(_frame, Frame(WalRecordTag::Ops, _max_body))
+                      .finish());
+  }
+};
+
+/**
+ * @brief Reads the log at path and calls fn for each intact record.
+ *
+ * fn receives the WalRecordTag and, for Ops records, the decoded
+ * WriteBatch. Reading stops at the first torn or corrupt frame (the tail
+ * of a write cut short by a crash), and the file is truncated there so new
+ * records follow the last good one. A missing file replays nothing.
+ *
+ * @return Number of records replayed, and the status.
+ */
+template <typename VertexType, typename EdgeType, typename Fn>
+std::pair<size_t, PeakStatus> replayWriteAheadLog(const std::string &path,
+                                                  Fn &&fn) {
+  using VertexCodec = WalCodec<VertexType>;
+  using EdgeCodec = WalCodec<EdgeType>;
+  std::error_code ec;
+  if (!std::filesystem::exists(path, ec))
+    return {0, PeakStatus::OK()};
+
+  std::ifstream in(path, std::ios::binary);
+  const uint64_t file_size = std::filesystem::file_size(path, ec);
+  if (!in || ec)
+    return {0, PeakStatus::InternalError("Cannot read write-ahead log: " +
+                                         path)};
+
+  size_t replayed = 0;
+  uint64_t good_end = 0;
+  std::string body;
+  for (;;) {
+    uint32_t header[2];
+    if (!in.read(reinterpret_cast<char *>(header), sizeof(header)))
+      break;
+    // A length running past the end of the file is a torn header; checking
+    // it before the checksum keeps garbage from allocating up to 4 GiB.
+    if (header[0] == 0 || header[0] > file_size - good_end - sizeof(header))
+      break;
+    body.resize(header[0]);
+    if (!in.read(body.data(), static_cast<std::streamsize>(body.size())) ||
+        walChecksum(body.data(), body.size()) != header[1])
+      break;
+
+    const char *pos = body.data();
+    const char *end = pos + body.size();
+    auto tag = static_cast<WalRecordTag>(*pos++);
+    WriteBatch<VertexType, EdgeType> batch;
+    bool ok = true;
+    if (tag == WalRecordTag::Ops) {
+      uint32_t count = 0;
+      ok = WalCodec<uint32_t>::decode(pos, end, count);
+      batch.reserve(ok ? count : 0);
+      for (uint32_t i = 0; ok && i < count; ++i) {
+        uint8_t kind = 0;
+        VertexType src{}, dest{};
+        EdgeType weight{};
+        ok = WalCodec<uint8_t>::decode(pos, end, kind) &&
+             VertexCodec::decode(pos, end, src);
+        switch (static_cast<BatchOpKind>(kind)) {
+        case BatchOpKind::AddVertex:
+          batch.addVertex(src);
+          break;
+        case BatchOpKind::RemoveVertex:
+          batch.removeVertex(src);
+          break;
+        case BatchOpKind::AddEdge:
+          ok = ok && VertexCodec::decode(pos, end, dest) &&
+               EdgeCodec::decode(pos, end, weight);
+          batch.addEdge(src, dest, weight);
+          break;
+        case BatchOpKind::RemoveEdge:
+          ok = ok && VertexCodec::decode(pos, end, dest);
+          batch.removeEdge(src, dest);
+          break;
+        case BatchOpKind::UpdateEdge:
+          ok = ok && VertexCodec::decode(pos, end, dest) &&
+               EdgeCodec::decode(pos, end, weight);
+          batch.updateEdge(src, dest, weight);
+          break;
+        default:
+          ok = false;
+        }
+      }
+    } else if (tag != WalRecordTag::ClearEdges &&
+               tag != WalRecordTag::ClearVertices) {
+      ok = false;
+    }
+    if (!ok)
+      break;
+
+    fn(tag, batch);
+    ++replayed;
+    good_end += sizeof(header) + body.size();
+  }
+  in.close();
+
+  if (file_size != good_end)
+    std::filesystem::resize_file(path, good_end, ec);
+  if (ec)
+    return {replayed, PeakStatus::InternalError(
+                          "Cannot truncate torn write-ahead log tail.")};
+  return {replayed, PeakStatus::OK()};
+}
+
+} // namespace CinderPeak
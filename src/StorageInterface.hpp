@@ -1,4 +1,5 @@
 #pragma once
+#include "Operations/WriteBatch.hpp"
 #include "StorageEngine/AdjacencyList.hpp"
 #include "StorageEngine/ErrorCodes.hpp"
 #include "StorageEngine/HybridCSR_COO.hpp"
@@ -7,6 +8,10 @@
 namespace CinderPeak {
 template <typename VertexType, typename EdgeType> class PeakStorageInterface {
 public:
+  // Read-only lookups take a LookupKey (std::string_view for string vertices)
+  // so they can be served without materialising a VertexType.
+  using LookupKey = VertexLookupKey<VertexType>;
+
   [[nodiscard]] virtual const PeakStatus
   impl_addVertex(const VertexType &src) = 0;
 
@@ -27,23 +32,53 @@ public:
   impl_addEdge(const VertexType &src, const VertexType &dest,
                const EdgeType &weight = EdgeType()) = 0;
 
+  // Validates and inserts src->dest under a single lock acquisition, so no
+  // other writer can slip in between the checks and the insert. Fails with
+  // VertexNotFound, InvalidArgument (self loop) or EdgeAlreadyExists.
+  [[nodiscard]] virtual const PeakStatus
+  impl_addEdgeChecked(const VertexType &src, const VertexType &dest,
+                      const EdgeType &weight, const EdgeInsertRules &rules) = 0;
+
+  // Undirected counterparts of add/remove/update: src->dest and dest->src are
+  // written under one lock hold, so readers never observe half an edge.
+  // impl_addEdgePair always checks both directions for duplicates
+  // (rules.directed is ignored). Remove and update fail without side effects
+  // when src->dest does not exist.
+  [[nodiscard]] virtual const PeakStatus
+  impl_addEdgePair(const VertexType &src, const VertexType &dest,
+                   const EdgeType &weight, const EdgeInsertRules &rules) = 0;
+
+  [[nodiscard]] virtual const std::pair<EdgeType, PeakStatus>
+  impl_removeEdgePair(const VertexType &src, const VertexType &dest) = 0;
+
+  [[nodiscard]] virtual const PeakStatus
+  impl_updateEdgePair(const VertexType &src, const VertexType &dest,
+                      const EdgeType &newWeight) = 0;
+
+  // Applies every operation of the batch in order under one lock hold.
+  // Edge operations write both directions when rules.directed is false.
+  // A failing operation is skipped and recorded in the result; the others
+  // still apply.
+  [[nodiscard]] virtual BatchResult
+  impl_applyBatch(const WriteBatch<VertexType, EdgeType> &batch,
+                  const EdgeInsertRules &rules) = 0;
+
   virtual const PeakStatus impl_updateEdge(const VertexType &src,
                                            const VertexType &dest,
                                            const EdgeType &newWeight) = 0;
 
   // Method to check whether a Vertex exists or not
-  [[nodiscard]] virtual bool impl_hasVertex(const VertexType &v) noexcept = 0;
+  [[nodiscard]] virtual bool impl_hasVertex(LookupKey v) noexcept = 0;
 
   [[nodiscard]] virtual bool
-  impl_doesEdgeExist(const VertexType &src, const VertexType &dest,
+  impl_doesEdgeExist(LookupKey src, LookupKey dest,
                      const EdgeType &weight) noexcept = 0;
 
-  [[nodiscard]] virtual bool
-  impl_doesEdgeExist(const VertexType &src,
-                     const VertexType &dest) noexcept = 0;
+  [[nodiscard]] virtual bool impl_doesEdgeExist(LookupKey src,
+                                                LookupKey dest) noexcept = 0;
 
   [[nodiscard]] virtual const std::pair<EdgeType, PeakStatus>
-  impl_getEdge(const VertexType &src, const VertexType &dest) = 0;
+  impl_getEdge(LookupKey src, LookupKey dest) = 0;
 
   virtual ~PeakStorageInterface() = default;
 
@@ -0,0 +1,57 @@
+#pragma once
+#include <cstddef>
+
+namespace CinderPeak {
+template <typename, typename> class PeakStorageInterface;
+
+namespace PeakStore {
+
+// Inline neighbor slots per AdjacencyList row before it spills to the heap.
+inline constexpr size_t DEFAULT_INLINE_NEIGHBORS = 4;
+
+template <typename VertexType, typename EdgeType,
+          size_t InlineNeighbors = DEFAULT_INLINE_NEIGHBORS>
+class AdjacencyList;
+
+} // namespace PeakStore
+
+/**
+ * @brief Storage policies pick how PeakStore reaches its storage backend.
+ *
+ * A policy names the storage type (`type<V, E>`) and binds it from the
+ * graph context (`bind(ctx)`). PeakStore calls every impl_* method through
+ * that static type.
+ *
+ * DynamicStorage is the default. It dispatches through PeakStorageInterface
+ * and follows ctx.active_storage, so the backend can be switched at runtime.
+ * AdjacencyStorage binds the (final) AdjacencyList directly. Calls are then
+ * resolved at compile time and can be inlined into the caller.
+ */
+struct DynamicStorage {
+  template <typename V, typename E> using type = PeakStorageInterface<V, E>;
+
+  template <typename Context> static auto *bind(const Context &ctx) {
+    return ctx.active_storage.get();
+  }
+};
+
+struct AdjacencyStorage {
+  template <typename V, typename E>
+  using type = PeakStore::AdjacencyList<V, E>;
+
+  template <typename Context> static auto *bind(const Context &ctx) {
+    return ctx.adjacency_storage.get();
+  }
+};
+
+namespace PeakStore {
+template <typename VertexType, typename EdgeType,
+          typename StoragePolicy = DynamicStorage>
+class PeakStore;
+} // namespace PeakStore
+
+template <typename VertexType, typename EdgeType,
+          typename StoragePolicy = DynamicStorage>
+class CinderGraph;
+
+} // namespace CinderPeak
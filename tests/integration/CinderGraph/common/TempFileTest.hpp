@@ -0,0 +1,41 @@
+#pragma once
+#include "gtest/gtest.h"
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+namespace CinderPeak {
+
+// Fixture owning one file per test under the system temp directory, named
+// after the suite and test. The file is removed before and after the test.
+class TempFileTest : public ::testing::Test {
+protected:
+  std::string path;
+
+  void SetUp() override {
+    const auto *info = ::testing::UnitTest::GetInstance()->current_test_info();
+    path = (std::filesystem::temp_directory_path() /
+            (std::string("cinderpeak_") + info->test_suite_name() + "_" +
+             info->name()))
+               .string();
+    std::filesystem::remove(path);
+  }
+
+  void TearDown() override { std::filesystem::remove(path); }
+
+  // Replaces the file's contents with text.
+  void write(const std::string &text) {
+    std::ofstream out(path, std::ios::binary);
+    out << text;
+  }
+};
+
+// graph.edges() in sorted order, for comparing graphs built different ways.
+template <typename G> auto sortedEdges(const G &graph) {
+  auto edges = graph.edges();
+  std::sort(edges.begin(), edges.end());
+  return edges;
+}
+
+} // namespace CinderPeak
@@ -0,0 +1,86 @@
+#pragma once
+#include "CinderPeak.hpp"
+#include <cstddef>
+#include <random>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace CinderPeak {
+
+// Out-edge CSR plus its transpose, built from an edge list over 0..n-1 for
+// testing kernels directly on a CSRView. Edges given as (u, v, w) tuples
+// also fill weights, aligned with targets.
+template <typename W = int> struct TestCSR {
+  std::vector<size_t> offsets, targets, inOffsets, inTargets;
+  std::vector<W> weights;
+
+  TestCSR(size_t n, const std::vector<std::pair<size_t, size_t>> &edges) {
+    build(n, edges);
+  }
+
+  TestCSR(size_t n, const std::vector<std::tuple<size_t, size_t, W>> &edges) {
+    build(n, edges);
+  }
+
+  Algorithms::CSRView view() const {
+    return {offsets.size() - 1, offsets.data(), targets.data(),
+            inOffsets.data(), inTargets.data()};
+  }
+
+private:
+  template <typename Edges> void build(size_t n, const Edges &edges) {
+    constexpr bool weighted =
+        std::tuple_size_v<typename Edges::value_type> == 3;
+    offsets.assign(n + 1, 0);
+    inOffsets.assign(n + 1, 0);
+    targets.resize(edges.size());
+    inTargets.resize(edges.size());
+    if (weighted)
+      weights.resize(edges.size());
+    for (const auto &edge : edges) {
+      ++offsets[std::get<0>(edge) + 1];
+      ++inOffsets[std::get<1>(edge) + 1];
+    }
+    for (size_t i = 0; i < n; ++i) {
+      offsets[i + 1] += offsets[i];
+      inOffsets[i + 1] += inOffsets[i];
+    }
+    auto out = offsets, in = inOffsets;
+    for (const auto &edge : edges) {
+      const size_t u = std::get<0>(edge), v = std::get<1>(edge);
+      if constexpr (weighted)
+        weights[out[u]] = std::get<2>(edge);
+      inTargets[in[v]++] = u;
+      targets[out[u]++] = v;
+    }
+  }
+};
+
+// count edges over 0..n-1 with uniformly random endpoints (self loops and
+// duplicates included).
+inline std::vector<std::pair<size_t, size_t>>
+randomEdges(std::mt19937 &rng, size_t n, size_t count) {
+  std::uniform_int_distribution<size_t> pick(0, n - 1);
+  std::vector<std::pair<size_t, size_t>> edges;
+  edges.reserve(count);
+  for (size_t i = 0; i < count; ++i) {
+    size_t u = pick(rng);
+    edges.emplace_back(u, pick(rng));
+  }
+  return edges;
+}
+
+// Calls check(options) once serially and once with three workers. Every
+// worker gets work however small the graph (minWorkPerWorker = 1).
+template <typename Options, typename Fn> void forEachWorkerCount(Fn &&check) {
+  for (size_t workers : {1u, 3u}) {
+    Options options;
+    options.workers = workers;
+    options.minWorkPerWorker = 1;
+    check(options);
+  }
+}
+
+} // namespace CinderPeak
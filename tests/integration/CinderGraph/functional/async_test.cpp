@@ -0,0 +1,127 @@
+#include "DummyGraphBuilder.hpp"
+#include "gtest/gtest.h"
+#include <atomic>
+#include <future>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+using namespace CinderPeak;
+
+TEST(AsyncTest, FuturesCarryResults) {
+  CinderGraph<int, int> graph;
+  graph.setAsyncWorkers(2);
+  EXPECT_EQ(graph.asyncWorkers(), 2u);
+
+  auto a = graph.addVertexAsync(1);
+  auto b = graph.addVertexAsync(2);
+  EXPECT_TRUE(a.get().second);
+  EXPECT_TRUE(b.get().second);
+  EXPECT_TRUE(graph.addEdgeAsync(1, 2, 7).get().second);
+
+  auto weight = graph.getEdgeAsync(1, 2);
+  auto neighbors = graph.getNeighborsAsync(1);
+  EXPECT_EQ(weight.get(), 7);
+  auto row = neighbors.get();
+  ASSERT_EQ(row.size(), 1u);
+  EXPECT_EQ(row[0], std::make_pair(2, 7));
+
+  EXPECT_EQ(graph.updateEdgeAsync(1, 2, 8).get().first, 7);
+  EXPECT_TRUE(graph.bfsAsync(1).get().isOK());
+  EXPECT_FALSE(graph.bfsAsync(9).get().isOK());
+  EXPECT_EQ(graph.removeEdgeAsync(1, 2).get().first, 8);
+  EXPECT_TRUE(graph.removeVertexAsync(2).get());
+  EXPECT_FALSE(graph.addVertexAsync(1).get().second);
+}
+
+TEST(AsyncTest, PipelinedWritesAllLand) {
+  constexpr int N = 2000;
+  CinderGraph<int, Unweighted> graph;
+  std::vector<std::future<std::pair<int, bool>>> pending;
+  pending.reserve(N);
+  for (int v = 0; v < N; ++v)
+    pending.push_back(graph.addVertexAsync(v));
+  for (auto &f : pending)
+    EXPECT_TRUE(f.get().second);
+
+  std::vector<std::future<std::pair<std::pair<int, int>, bool>>> edges;
+  for (int v = 0; v + 1 < N; ++v)
+    edges.push_back(graph.addEdgeAsync(v, v + 1));
+  graph.waitAsync();
+  for (auto &f : edges)
+    EXPECT_TRUE(f.get().second);
+  EXPECT_EQ(graph.numVertices(), static_cast<size_t>(N));
+  EXPECT_EQ(graph.numEdges(), static_cast<size_t>(N - 1));
+}
+
+TEST(AsyncTest, ExceptionsArriveThroughTheFuture) {
+  CinderGraph<std::string, int> graph;
+  auto failing = graph.async([](CinderGraph<std::string, int> &) -> int {
+    throw std::runtime_error("boom");
+  });
+  EXPECT_THROW(failing.get(), std::runtime_error);
+  EXPECT_FALSE(graph.removeVertexAsync("nowhere").get());
+
+  auto custom = graph.async([](CinderGraph<std::string, int> &g) {
+    g.addVertex("A");
+    return g.numVertices();
+  });
+  EXPECT_EQ(custom.get(), 1u);
+
+  WriteBatch<std::string, int> batch;
+  batch.addVertex("B").addEdge("A", "B", 3);
+  EXPECT_TRUE(graph.applyAsync(std::move(batch)).get().allApplied());
+  EXPECT_EQ(graph.getEdge("A", "B"), 3);
+}
+
+TEST(AsyncTest, MoveAndDestroyWaitForQueuedCalls) {
+  std::vector<std::future<std::pair<int, bool>>> pending;
+  CinderGraph<int, int> moved;
+  {
+    CinderGraph<int, int> graph;
+    graph.setAsyncWorkers(1);
+    for (int v = 0; v < 500; ++v)
+      pending.push_back(graph.addVertexAsync(v));
+    moved = std::move(graph);
+  }
+  EXPECT_EQ(moved.numVertices(), 500u);
+  for (auto &f : pending) {
+    ASSERT_EQ(f.wait_for(std::chrono::seconds(0)), std::future_status::ready);
+    EXPECT_TRUE(f.get().second);
+  }
+
+  std::future<std::pair<int, bool>> last;
+  {
+    CinderGraph<int, int> graph;
+    last = graph.addVertexAsync(42);
+  }
+  EXPECT_EQ(last.wait_for(std::chrono::seconds(0)), std::future_status::ready);
+}
+
+TEST(AsyncTest, ResizingWhileSubmitting) {
+  CinderGraph<int, int> graph;
+  std::atomic<bool> done{false};
+  std::vector<std::thread> submitters;
+  std::vector<std::vector<std::future<std::pair<int, bool>>>> pending(3);
+  for (int t = 0; t < 3; ++t)
+    submitters.emplace_back([&, t] {
+      for (int v = t; !done.load(); v += 3)
+        pending[t].push_back(graph.addVertexAsync(v));
+    });
+  // Each resize joins one generation of workers while posts keep arriving.
+  for (size_t i = 0; i < 300; ++i)
+    graph.setAsyncWorkers(i % 4 + 1);
+  done = true;
+  for (auto &t : submitters)
+    t.join();
+
+  size_t total = 0;
+  for (auto &futures : pending) {
+    total += futures.size();
+    for (auto &f : futures)
+      EXPECT_TRUE(f.get().second);
+  }
+  EXPECT_EQ(graph.numVertices(), total);
+}
@@ -0,0 +1,143 @@
+#include "DummyGraphBuilder.hpp"
+#include "TestCSR.hpp"
+#include "gtest/gtest.h"
+#include <algorithm>
+#include <map>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace CinderPeak;
+using namespace CinderPeak::Algorithms;
+
+namespace {
+bool hasEdge(const CSRView &g, size_t u, size_t v) {
+  return std::find(g.targets + g.offsets[u], g.targets + g.offsets[u + 1],
+                   v) != g.targets + g.offsets[u + 1];
+}
+} // namespace
+
+TEST(BFSTest, ReportsOrderDepthAndParents) {
+  CinderGraph<std::string, int> graph;
+  for (const char *v : {"A", "B", "C", "D", "E"})
+    graph.addVertex(v);
+  graph.addEdge("A", "B", 1);
+  graph.addEdge("A", "C", 1);
+  graph.addEdge("B", "D", 1);
+  graph.addEdge("C", "D", 1);
+  graph.addEdge("E", "A", 1); // E is not reachable from A
+
+  auto result = graph.bfs("A");
+  ASSERT_TRUE(result.isOK());
+  ASSERT_EQ(result.order_.size(), 4u);
+  EXPECT_EQ(result.order_[0], "A");
+  EXPECT_EQ(result.parent_[0], "A");
+  std::map<std::string, size_t> depth;
+  for (size_t i = 0; i < result.order_.size(); ++i)
+    depth[result.order_[i]] = result.depth_[i];
+  EXPECT_EQ(depth, (std::map<std::string, size_t>{
+                       {"A", 0}, {"B", 1}, {"C", 1}, {"D", 2}}));
+  EXPECT_TRUE(std::is_sorted(result.depth_.begin(), result.depth_.end()));
+
+  EXPECT_FALSE(graph.bfs("Z").isOK());
+}
+
+TEST(BFSTest, SeesMutationsMadeBetweenTraversals) {
+  CinderGraph<int, Unweighted> graph(
+      GraphCreationOptions({GraphCreationOptions::Undirected}));
+  for (int v = 1; v <= 4; ++v)
+    graph.addVertex(v);
+  graph.addEdge(2, 1);
+  EXPECT_EQ(graph.bfs(1).order_.size(), 2u);
+
+  graph.addEdge(2, 3);
+  graph.addEdge(3, 4);
+  auto result = graph.bfs(1);
+  EXPECT_EQ(result.order_.size(), 4u);
+  EXPECT_EQ(result.depth_.back(), 3u);
+
+  graph.removeVertex(3);
+  EXPECT_EQ(graph.bfs(4).order_.size(), 1u);
+  graph.clearEdges();
+  EXPECT_EQ(graph.bfs(1).order_.size(), 1u);
+}
+
+TEST(BFSTest, DirectionOptimizingMatchesQueueBFS) {
+  std::mt19937 rng(7);
+  for (size_t n : {1u, 50u, 2000u}) {
+    for (double avgDegree : {1.5, 16.0}) {
+      std::uniform_int_distribution<size_t> pick(0, n - 1);
+      std::vector<std::pair<size_t, size_t>> edges;
+      const size_t count =
+          static_cast<size_t>(static_cast<double>(n) * avgDegree);
+      for (size_t i = 0; i < count; ++i)
+        edges.emplace_back(pick(rng), pick(rng));
+      TestCSR csr(n, edges);
+      CSRView g = csr.view();
+
+      BFSTree expected = queueBFS(g, 0);
+      for (BFSOptions options : {BFSOptions{}, BFSOptions{1, 1000000}}) {
+        BFSTree tree = directionOptimizingBFS(g, 0, options);
+        EXPECT_EQ(tree.depth, expected.depth);
+        EXPECT_EQ(tree.order.size(), expected.order.size());
+        for (size_t v = 0; v < n; ++v) {
+          if (v == 0 || tree.depth[v] == UNREACHED)
+            continue;
+          size_t p = tree.parent[v];
+          ASSERT_NE(p, UNREACHED);
+          EXPECT_EQ(tree.depth[p] + 1, tree.depth[v]);
+          EXPECT_TRUE(hasEdge(g, p, v));
+        }
+      }
+    }
+  }
+}
+
+TEST(BFSTest, ParallelBFSMatchesQueueBFSExactly) {
+  std::mt19937 rng(11);
+  for (size_t n : {1u, 60u, 3000u}) {
+    for (double avgDegree : {0.8, 12.0}) {
+      std::uniform_int_distribution<size_t> pick(0, n - 1);
+      std::vector<std::pair<size_t, size_t>> edges;
+      const size_t count =
+          static_cast<size_t>(static_cast<double>(n) * avgDegree);
+      for (size_t i = 0; i < count; ++i)
+        edges.emplace_back(pick(rng), pick(rng));
+      for (size_t i = 0; n > 1 && i < 400; ++i)
+        edges.emplace_back(1, pick(rng)); // a hub split across chunks
+      TestCSR csr(n, edges);
+      CSRView g = csr.view();
+
+      BFSTree expected = queueBFS(g, 0);
+      for (size_t workers : {2u, 5u}) {
+        BFSTree tree = parallelBFS(g, 0, ParallelBFSOptions{workers, 1});
+        EXPECT_EQ(tree.order, expected.order);
+        EXPECT_EQ(tree.depth, expected.depth);
+        EXPECT_EQ(tree.parent, expected.parent);
+      }
+    }
+  }
+}
+
+TEST(BFSTest, ParallelBFSThroughTheGraph) {
+  CinderGraph<int, Unweighted> graph(
+      GraphCreationOptions({GraphCreationOptions::Undirected}));
+  for (int v = 0; v < 200; ++v)
+    graph.addVertex(v);
+  for (int v = 1; v < 200; ++v)
+    graph.addEdge(v / 3, v);
+
+  auto serial = graph.bfs(0);
+  auto parallel = graph.parallelBFS(0, ParallelBFSOptions{4, 1});
+  ASSERT_TRUE(parallel.isOK());
+  EXPECT_EQ(parallel.order_.size(), 200u);
+  std::map<int, size_t> serialDepth, parallelDepth;
+  for (size_t i = 0; i < serial.order_.size(); ++i)
+    serialDepth[serial.order_[i]] = serial.depth_[i];
+  for (size_t i = 0; i < parallel.order_.size(); ++i) {
+    parallelDepth[parallel.order_[i]] = parallel.depth_[i];
+    EXPECT_EQ(parallel.parent_[i], parallel.order_[i] / 3);
+  }
+  EXPECT_EQ(parallelDepth, serialDepth);
+  EXPECT_FALSE(graph.parallelBFS(500).isOK());
+}
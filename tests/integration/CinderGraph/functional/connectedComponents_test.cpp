@@ -0,0 +1,102 @@
+#include "DummyGraphBuilder.hpp"
+#include "TestCSR.hpp"
+#include "gtest/gtest.h"
+#include <numeric>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace CinderPeak;
+using namespace CinderPeak::Algorithms;
+
+namespace {
+// Serial union-find labels, numbered by each component's first vertex.
+std::vector<size_t>
+referenceComponents(size_t n,
+                    const std::vector<std::pair<size_t, size_t>> &edges) {
+  std::vector<size_t> parent(n);
+  std::iota(parent.begin(), parent.end(), 0);
+  auto find = [&](size_t v) {
+    while (parent[v] != v)
+      v = parent[v] = parent[parent[v]];
+    return v;
+  };
+  for (const auto &[u, v] : edges)
+    parent[find(u)] = find(v);
+  std::vector<size_t> label(n), labelOfRoot(n, SIZE_MAX);
+  size_t next = 0;
+  for (size_t v = 0; v < n; ++v) {
+    size_t root = find(v);
+    if (labelOfRoot[root] == SIZE_MAX)
+      labelOfRoot[root] = next++;
+    label[v] = labelOfRoot[root];
+  }
+  return label;
+}
+} // namespace
+
+TEST(ConnectedComponentsTest, UndirectedGraph) {
+  CinderGraph<std::string, int> graph(
+      GraphCreationOptions({GraphCreationOptions::Undirected}));
+  for (const char *v : {"A", "B", "C", "D", "E", "F"})
+    graph.addVertex(v);
+  graph.addEdge("A", "B", 1);
+  graph.addEdge("B", "C", 1);
+  graph.addEdge("D", "E", 1);
+
+  auto result = graph.connectedComponents();
+  ASSERT_TRUE(result.isOK());
+  EXPECT_EQ(result.count(), 3u);
+  EXPECT_TRUE(result.sameComponent("A", "C"));
+  EXPECT_TRUE(result.sameComponent("E", "D"));
+  EXPECT_FALSE(result.sameComponent("A", "D"));
+  EXPECT_FALSE(result.sameComponent("F", "Z"));
+  EXPECT_FALSE(result.componentOf("Z").has_value());
+  EXPECT_EQ(result.sizes_[*result.componentOf("B")], 3u);
+  EXPECT_EQ(result.sizes_[*result.componentOf("F")], 1u);
+
+  graph.addEdge("C", "D", 1);
+  auto merged = graph.connectedComponents();
+  EXPECT_EQ(merged.count(), 2u);
+  EXPECT_TRUE(merged.sameComponent("A", "E"));
+}
+
+TEST(ConnectedComponentsTest, DirectedGraphsUseWeakConnectivity) {
+  CinderGraph<int, Unweighted> graph;
+  for (int v = 0; v < 5; ++v)
+    graph.addVertex(v);
+  // 0 and 2 only point into 1; 3 only points at 4.
+  graph.addEdge(0, 1);
+  graph.addEdge(2, 1);
+  graph.addEdge(3, 4);
+
+  auto result = graph.connectedComponents();
+  ASSERT_TRUE(result.isOK());
+  EXPECT_EQ(result.count(), 2u);
+  EXPECT_TRUE(result.sameComponent(0, 2));
+  EXPECT_TRUE(result.sameComponent(4, 3));
+  EXPECT_FALSE(result.sameComponent(2, 3));
+}
+
+TEST(ConnectedComponentsTest, ParallelMatchesReference) {
+  std::mt19937 rng(8);
+  for (size_t n : {1u, 50u, 4000u}) {
+    // Sparse enough to leave many small components beside a large one.
+    auto edges = randomEdges(rng, n, n * 3 / 5);
+    TestCSR csr(n, edges);
+    CSRView g = csr.view();
+
+    auto expected = referenceComponents(n, edges);
+    forEachWorkerCount<ComponentsOptions>([&](ComponentsOptions options) {
+      for (size_t rounds : {0u, 2u}) {
+        options.neighborRounds = rounds;
+        ComponentLabels labels = connectedComponents(g, options);
+        EXPECT_EQ(labels.component, expected);
+        EXPECT_EQ(std::accumulate(labels.sizes.begin(), labels.sizes.end(),
+                                  size_t{0}),
+                  n);
+      }
+    });
+  }
+}
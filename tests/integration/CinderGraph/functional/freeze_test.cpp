@@ -0,0 +1,96 @@
+#include "DummyGraphBuilder.hpp"
+#include "gtest/gtest.h"
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using namespace CinderPeak;
+
+class FreezeTest : public ::testing::Test {
+protected:
+  DummyGraph builder;
+};
+
+TEST_F(FreezeTest, FrozenGraphAnswersReads) {
+  auto graph = builder.CreatePrimitiveWeightedGraph();
+  for (int v = 1; v <= 4; ++v)
+    graph.addVertex(v);
+  graph.addEdge(1, 3, 13);
+  graph.addEdge(1, 2, 12);
+  graph.addEdge(3, 4, 34);
+  graph.removeVertex(2); // leaves a gap in the source ids
+
+  auto frozen = graph.freeze();
+  EXPECT_EQ(frozen.numVertices(), 3u);
+  EXPECT_EQ(frozen.numEdges(), 2u);
+  EXPECT_TRUE(frozen.isDirected());
+  EXPECT_TRUE(frozen.hasVertex(4));
+  EXPECT_FALSE(frozen.hasVertex(2));
+  EXPECT_EQ(frozen.getEdge(1, 3).value_or(0), 13);
+  EXPECT_FALSE(frozen.getEdge(3, 1).has_value());
+  EXPECT_FALSE(frozen.getEdge(9, 1).has_value());
+  EXPECT_EQ(frozen.getNeighbors(1).size(), 1u);
+  EXPECT_TRUE(frozen.getNeighbors(9).empty());
+
+  // Rows are sorted by destination index.
+  const auto &offsets = frozen.rowOffsets();
+  const auto &columns = frozen.columns();
+  for (size_t i = 0; i < frozen.numVertices(); ++i)
+    EXPECT_TRUE(std::is_sorted(columns.begin() + offsets[i],
+                               columns.begin() + offsets[i + 1]));
+
+  // The snapshot is unaffected by later writes to the source graph.
+  graph.addEdge(4, 1, 41);
+  EXPECT_FALSE(frozen.getEdge(4, 1).has_value());
+}
+
+TEST_F(FreezeTest, ConcurrentReadersNeedNoLocks) {
+  std::vector<std::pair<int, int>> edges;
+  for (int v = 0; v < 2000; ++v)
+    edges.emplace_back(v, (v + 1) % 2000);
+  auto frozen = CinderGraph<int, Unweighted>::fromEdges(edges).freeze();
+
+  std::atomic<int> misses{0};
+  std::vector<std::thread> readers;
+  for (int t = 0; t < 4; ++t) {
+    readers.emplace_back([&] {
+      for (int v = 0; v < 2000; ++v) {
+        auto idx = frozen.vertexIndex(v);
+        if (!idx || frozen.degree(*idx) != 1 ||
+            !frozen.getEdge(v, (v + 1) % 2000))
+          misses.fetch_add(1);
+      }
+    });
+  }
+  for (auto &t : readers)
+    t.join();
+  EXPECT_EQ(misses.load(), 0);
+}
+
+TEST_F(FreezeTest, ThawRestoresAMutableGraph) {
+  auto graph = builder.CreateStringWeightedGraph(GraphOpts::undirected);
+  graph.addVertex("A");
+  graph.addVertex("B");
+  graph.addVertex("C");
+  graph.addVertex("lonely");
+  graph.addEdge("A", "B", 1.5f);
+  graph.addEdge("B", "C", 2.5f);
+
+  auto frozen = graph.freeze();
+  EXPECT_FALSE(frozen.isDirected());
+  EXPECT_EQ(frozen.numEdges(), 4u);
+  EXPECT_FLOAT_EQ(frozen.getEdge("C", "B").value_or(0.0f), 2.5f);
+
+  auto thawed = frozen.thaw();
+  EXPECT_EQ(thawed.numVertices(), 4u);
+  EXPECT_EQ(thawed.numEdges(), 4u);
+  EXPECT_TRUE(thawed.hasVertex("lonely"));
+  EXPECT_FLOAT_EQ(thawed.getEdge("B", "A").value_or(0.0f), 1.5f);
+
+  // Thawed graphs keep the undirected rules.
+  EXPECT_FALSE(thawed.addEdge("B", "A", 1.5f).second);
+  EXPECT_TRUE(thawed.addEdge("C", "lonely", 3.0f).second);
+  EXPECT_TRUE(thawed.getEdge("lonely", "C").has_value());
+  EXPECT_EQ(thawed.numEdges(), 6u);
+}
@@ -0,0 +1,97 @@
+#include "DummyGraphBuilder.hpp"
+#include "Operations/BulkBuild.hpp"
+#include "gtest/gtest.h"
+#include <algorithm>
+#include <random>
+#include <set>
+#include <string>
+#include <tuple>
+#include <vector>
+
+using namespace CinderPeak;
+
+TEST(FromEdgesTest, BuildsDirectedWeightedGraph) {
+  std::vector<std::tuple<int, int, int>> edges = {
+      {1, 2, 5}, {2, 3, 7}, {1, 2, 5}, // exact duplicate
+      {1, 2, 6},                       // same pair, new weight
+      {3, 3, 1},                       // self loop
+      {3, 1, 2}};
+  auto graph = CinderGraph<int, int>::fromEdges(edges);
+
+  EXPECT_EQ(graph.numVertices(), 3u);
+  EXPECT_EQ(graph.numEdges(), 4u);
+  EXPECT_TRUE(graph.getEdge(3, 1).has_value());
+  EXPECT_FALSE(graph.getEdge(1, 3).has_value());
+  EXPECT_FALSE(graph.getEdge(3, 3).has_value());
+  EXPECT_EQ(graph.getNeighbors(1).size(), 2u);
+
+  // The graph stays usable through the normal API.
+  EXPECT_TRUE(graph.addVertex(4).second);
+  EXPECT_TRUE(graph.addEdge(4, 1, 9).second);
+  EXPECT_FALSE(graph.addEdge(2, 3, 7).second);
+  EXPECT_EQ(graph.numEdges(), 5u);
+}
+
+TEST(FromEdgesTest, UndirectedEdgesAreStoredBothWays) {
+  std::vector<std::pair<std::string, std::string>> edges = {
+      {"A", "B"}, {"B", "A"}, {"B", "C"}, {"C", "B"}, {"A", "C"}};
+  auto graph = CinderGraph<std::string, Unweighted>::fromEdges(
+      edges, GraphCreationOptions({GraphCreationOptions::Undirected}));
+
+  EXPECT_EQ(graph.numVertices(), 3u);
+  EXPECT_EQ(graph.numEdges(), 6u);
+  for (const char *v : {"A", "B", "C"})
+    EXPECT_EQ(graph.getNeighbors(v).size(), 2u) << v;
+  EXPECT_TRUE(graph.removeEdge("C", "A").second);
+  EXPECT_FALSE(graph.getEdge("A", "C").has_value());
+}
+
+TEST(FromEdgesTest, ParallelBuildMatchesSequentialBuild) {
+  std::mt19937 rng(7);
+  std::uniform_int_distribution<int> vertex(0, 499);
+  std::vector<std::pair<int, int>> edges(20000);
+  for (auto &edge : edges)
+    edge = {vertex(rng), vertex(rng)};
+
+  EdgeInsertRules rules{false, true};
+  auto sequential = buildEdgeSet<int, Unweighted>(edges, rules, 1);
+  auto parallel = buildEdgeSet<int, Unweighted>(edges, rules, 4);
+  ASSERT_EQ(sequential.vertices.size(), parallel.vertices.size());
+  ASSERT_EQ(sequential.edges.size(), parallel.edges.size());
+
+  auto valuePairs = [](const BulkEdgeSet<int, Unweighted> &set) {
+    std::set<std::pair<int, int>> out;
+    for (const auto &edge : set.edges)
+      out.emplace(set.vertices[edge.src - 1], set.vertices[edge.dest - 1]);
+    return out;
+  };
+  auto expected = valuePairs(sequential);
+  EXPECT_EQ(expected, valuePairs(parallel));
+
+  std::set<std::pair<int, int>> reference;
+  for (const auto &edge : edges) {
+    if (edge.first != edge.second)
+      reference.insert(edge);
+  }
+  EXPECT_EQ(expected, reference);
+  EXPECT_TRUE(std::is_sorted(
+      parallel.edges.begin(), parallel.edges.end(),
+      [](const auto &a, const auto &b) {
+        return a.src != b.src ? a.src < b.src : a.dest < b.dest;
+      }));
+}
+
+TEST(FromEdgesTest, ParallelSortMatchesStdSort) {
+  std::mt19937 rng(11);
+  std::vector<int> values(10007);
+  for (auto &v : values)
+    v = static_cast<int>(rng() % 1000);
+  std::vector<int> expected = values;
+  std::sort(expected.begin(), expected.end());
+
+  for (size_t workers : {2u, 3u, 5u, 8u}) {
+    std::vector<int> sorted = values;
+    PeakStore::parallelSort(sorted, std::less<int>(), workers);
+    EXPECT_EQ(sorted, expected) << workers << " workers";
+  }
+}
@@ -0,0 +1,128 @@
+#include "DummyGraphBuilder.hpp"
+#include "TempFileTest.hpp"
+#include "gtest/gtest.h"
+#include <random>
+#include <string>
+#include <tuple>
+#include <vector>
+
+using namespace CinderPeak;
+
+namespace {
+class FromFileTest : public TempFileTest {};
+} // namespace
+
+TEST_F(FromFileTest, ReadsWhitespaceAndCsvEdgeLists) {
+  write("# comment\n"
+        "1 2 0.5\n"
+        "  2\t3\t1.25\r\n"
+        "\n"
+        "3,1,-2\n"
+        "% another comment\n"
+        "1 2 0.5\n" // duplicate
+        "4 4 1");   // self loop, no trailing newline
+  auto graph = CinderGraph<int, double>::fromFile(path);
+
+  EXPECT_EQ(graph.numVertices(), 4u);
+  EXPECT_EQ(graph.numEdges(), 3u);
+  EXPECT_EQ(graph.getEdge(1, 2), 0.5);
+  EXPECT_EQ(graph.getEdge(2, 3), 1.25);
+  EXPECT_EQ(graph.getEdge(3, 1), -2.0);
+}
+
+TEST_F(FromFileTest, UnweightedGraphIgnoresWeights) {
+  write("10 20 7\n20 30\n30 10 1.5\n");
+  auto graph = CinderGraph<long, Unweighted>::fromFile(
+      path, GraphCreationOptions({GraphCreationOptions::Undirected}));
+  EXPECT_EQ(graph.numVertices(), 3u);
+  EXPECT_EQ(graph.numEdges(), 6u);
+  EXPECT_TRUE(graph.getEdge(10, 30).has_value());
+}
+
+TEST_F(FromFileTest, ReadsMatrixMarket) {
+  write("%%MatrixMarket matrix coordinate real symmetric\n"
+        "% comment\n"
+        "5 5 3\n"
+        "2 1 1.5\n"
+        "3 2 2.5\n"
+        "3 3 9\n");
+  auto graph = CinderGraph<int, float>::fromFile(path);
+  // Indices 1..5 all become vertices, including isolated 4 and 5.
+  EXPECT_EQ(graph.numVertices(), 5u);
+  EXPECT_EQ(graph.numEdges(), 4u);
+  EXPECT_EQ(graph.getEdge(1, 2), 1.5f);
+  EXPECT_EQ(graph.getEdge(2, 1), 1.5f);
+  EXPECT_EQ(graph.getEdge(2, 3), 2.5f);
+
+  write("%%MatrixMarket matrix coordinate pattern general\n"
+        "3 3 2\n1 2\n2 3\n");
+  auto pattern = CinderGraph<int, int>::fromFile(path);
+  EXPECT_EQ(pattern.numEdges(), 2u);
+  EXPECT_FALSE(pattern.getEdge(2, 1).has_value());
+}
+
+TEST_F(FromFileTest, ReportsTheBadLine) {
+  write("1 2 3\n2 x\n");
+  auto set = PeakStore::readEdgeListFile<int, int>(path, {true, true});
+  EXPECT_FALSE(set.second.isOK());
+  EXPECT_NE(set.second.message().find("line 2"), std::string::npos);
+
+  write("%%MatrixMarket matrix coordinate integer general\n2 2 1\n1 3 4\n");
+  auto outOfRange = PeakStore::readEdgeListFile<int, int>(path, {true, true});
+  EXPECT_FALSE(outOfRange.second.isOK());
+
+  auto missing =
+      PeakStore::readEdgeListFile<int, int>(path + ".missing", {true, true});
+  EXPECT_EQ(missing.second.code(), StatusCode::NOT_FOUND);
+}
+
+TEST_F(FromFileTest, RejectsTrailingJunk) {
+  for (const char *line : {"1 2x\n", "1 2 3 junk\n", "1 2 3.5\n"}) {
+    write(std::string("3 4 1\n") + line);
+    auto set = PeakStore::readEdgeListFile<int, int>(path, {true, true});
+    EXPECT_FALSE(set.second.isOK()) << line;
+    EXPECT_NE(set.second.message().find("line 2"), std::string::npos)
+        << line;
+  }
+  // A weighted graph needs the weight column.
+  write("1 2 3\n3 4\n");
+  auto noWeight = PeakStore::readEdgeListFile<int, int>(path, {true, true});
+  EXPECT_FALSE(noWeight.second.isOK());
+  EXPECT_NE(noWeight.second.message().find("line 2"), std::string::npos);
+
+  // An unweighted graph skips the weight column but still checks it.
+  write("1 2 3 4\n");
+  auto unweighted =
+      PeakStore::readEdgeListFile<int, Unweighted>(path, {false, true});
+  EXPECT_FALSE(unweighted.second.isOK());
+
+  // Weights cannot be parsed into a non-arithmetic edge type.
+  write("1 2 3\n");
+  auto named =
+      PeakStore::readEdgeListFile<int, std::string>(path, {true, true});
+  EXPECT_EQ(named.second.code(), StatusCode::INVALID_ARGUMENT);
+}
+
+TEST_F(FromFileTest, ParallelChunksMatchSequentialParse) {
+  std::mt19937 rng(3);
+  std::uniform_int_distribution<int> vertex(0, 999);
+  std::string text;
+  for (int i = 0; i < 50000; ++i)
+    text += std::to_string(vertex(rng)) + " " + std::to_string(vertex(rng)) +
+            " " + std::to_string(i % 17) + "\n";
+  write(text);
+
+  EdgeInsertRules rules{true, true};
+  EdgeListImportOptions one, many;
+  one.workers = 1;
+  many.workers = 7;
+  auto sequential = PeakStore::readEdgeListFile<int, int>(path, rules, one);
+  auto parallel = PeakStore::readEdgeListFile<int, int>(path, rules, many);
+  ASSERT_TRUE(sequential.second.isOK());
+  ASSERT_TRUE(parallel.second.isOK());
+  ASSERT_EQ(sequential.first.edges.size(), parallel.first.edges.size());
+
+  auto a = sortedEdges(CinderGraph<int, int>::fromEdgeSet(sequential.first));
+  auto b = sortedEdges(CinderGraph<int, int>::fromEdgeSet(parallel.first));
+  EXPECT_EQ(a, b);
+}
@@ -0,0 +1,76 @@
+#include "DummyGraphBuilder.hpp"
+#include "gtest/gtest.h"
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#include <string>
+#include <string_view>
+
+// Counts heap allocations so the tests can assert that string_view lookups
+// never build a temporary std::string.
+static std::atomic<size_t> g_allocations{0};
+
+void *operator new(std::size_t size) {
+  g_allocations.fetch_add(1, std::memory_order_relaxed);
+  if (void *p = std::malloc(size ? size : 1))
+    return p;
+  throw std::bad_alloc();
+}
+void operator delete(void *p) noexcept { std::free(p); }
+void operator delete(void *p, std::size_t) noexcept { std::free(p); }
+
+using namespace CinderPeak;
+
+class HeterogeneousLookupTest : public ::testing::Test {
+protected:
+  CinderGraph<std::string, int> graph{
+      GraphCreationOptions({GraphCreationOptions::Directed})};
+  const std::string src = "https://example.com/a/long/source/page";
+  const std::string dest = "https://example.com/a/long/target/page";
+
+  void SetUp() override {
+    graph.addVertex(src);
+    graph.addVertex(dest);
+    graph.addEdge(src, dest, 7);
+  }
+};
+
+TEST_F(HeterogeneousLookupTest, StringViewAndCStringQueries) {
+  std::string_view srcView = src;
+  EXPECT_TRUE(graph.hasVertex(srcView));
+  EXPECT_TRUE(graph.hasVertex(src.c_str()));
+  EXPECT_TRUE(graph.hasVertex(src));
+  EXPECT_FALSE(graph.hasVertex(std::string_view("missing")));
+
+  auto weight = graph.getEdge(srcView, std::string_view(dest));
+  ASSERT_TRUE(weight.has_value());
+  EXPECT_EQ(*weight, 7);
+
+  auto neighbors = graph.getNeighbors(srcView);
+  ASSERT_EQ(neighbors.size(), 1u);
+  EXPECT_EQ(neighbors[0].first, dest);
+}
+
+TEST_F(HeterogeneousLookupTest, LookupsDoNotAllocate) {
+  std::string_view srcView = src;
+  std::string_view destView = dest;
+
+  size_t before = g_allocations.load();
+  bool found = graph.hasVertex(srcView);
+  bool missing = graph.hasVertex("not-a-vertex-with-a-long-name");
+  auto weight = graph.getEdge(srcView, destView);
+  size_t after = g_allocations.load();
+
+  EXPECT_TRUE(found);
+  EXPECT_FALSE(missing);
+  EXPECT_TRUE(weight.has_value());
+  EXPECT_EQ(after - before, 0u);
+}
+
+TEST(VertexHasherTest, TransparentStringHashing) {
+  VertexHasher<std::string> hasher;
+  std::string s = "vertex";
+  EXPECT_EQ(hasher(s), hasher(std::string_view("vertex")));
+  EXPECT_EQ(hasher(s), hasher("vertex"));
+  EXPECT_TRUE(VertexEqual<std::string>{}(s, std::string_view("vertex")));
+}
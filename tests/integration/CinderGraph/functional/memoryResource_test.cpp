@@ -0,0 +1,104 @@
+#include "CinderPeak.hpp"
+#include "gtest/gtest.h"
+#include <cstddef>
+#include <memory_resource>
+#include <optional>
+#include <string>
+#include <vector>
+
+using namespace CinderPeak;
+
+// Forwards to new/delete and tracks outstanding bytes.
+class CountingResource : public std::pmr::memory_resource {
+public:
+  size_t allocations = 0;
+  size_t outstanding = 0;
+
+private:
+  void *do_allocate(size_t bytes, size_t align) override {
+    ++allocations;
+    outstanding += bytes;
+    return std::pmr::new_delete_resource()->allocate(bytes, align);
+  }
+  void do_deallocate(void *p, size_t bytes, size_t align) override {
+    outstanding -= bytes;
+    std::pmr::new_delete_resource()->deallocate(p, bytes, align);
+  }
+  bool do_is_equal(const memory_resource &other) const noexcept override {
+    return this == &other;
+  }
+};
+
+TEST(MemoryResourceTest, StoragesAllocateFromGivenResource) {
+  CountingResource counting;
+  {
+    GraphCreationOptions opts({GraphCreationOptions::Directed});
+    opts.setMemoryResource(&counting);
+    CinderGraph<std::string, int> graph(opts);
+    for (int i = 0; i < 50; ++i)
+      graph.addVertex("vertex-" + std::to_string(i));
+    for (int i = 1; i < 50; ++i)
+      graph.addEdge("vertex-0", "vertex-" + std::to_string(i), i);
+
+    EXPECT_GT(counting.allocations, 0u);
+    EXPECT_GT(counting.outstanding, 0u);
+    EXPECT_EQ(graph.numEdges(), 49u);
+    EXPECT_EQ(graph.getNeighbors("vertex-0").size(), 49u);
+  }
+  EXPECT_EQ(counting.outstanding, 0u);
+}
+
+TEST(MemoryResourceTest, GraphFitsInMonotonicArena) {
+  // With a null upstream any allocation that escapes the buffer throws, so
+  // this also checks that the storages never fall back to the default heap.
+  std::vector<std::byte> buffer(8 << 20);
+  std::pmr::monotonic_buffer_resource arena(buffer.data(), buffer.size(),
+                                            std::pmr::null_memory_resource());
+  for (int round = 0; round < 3; ++round) {
+    {
+      GraphCreationOptions opts({GraphCreationOptions::Undirected});
+      opts.setMemoryResource(&arena);
+      CinderGraph<int, int> graph(opts);
+      for (int v = 0; v < 100; ++v)
+        graph.addVertex(v);
+      for (int v = 1; v < 100; ++v)
+        graph.addEdge(v - 1, v, v);
+      EXPECT_EQ(graph.numVertices(), 100u);
+      EXPECT_EQ(graph.getEdge(41, 42).value_or(0), 42);
+    }
+    arena.release();
+  }
+}
+
+TEST(MemoryResourceTest, DefaultsToDefaultResource) {
+  GraphCreationOptions opts({GraphCreationOptions::Directed});
+  EXPECT_EQ(opts.memoryResource(), std::pmr::get_default_resource());
+}
+
+TEST(MemoryResourceTest, ThawDoesNotReuseTheSourceResource) {
+  std::optional<FrozenGraph<std::string, int>> frozen;
+  {
+    CountingResource source;
+    GraphCreationOptions opts({GraphCreationOptions::Directed});
+    opts.setMemoryResource(&source);
+    CinderGraph<std::string, int> graph(opts);
+    graph.addVertex("A");
+    graph.addVertex("B");
+    graph.addEdge("A", "B", 1);
+    frozen.emplace(graph.freeze());
+  }
+
+  auto thawed = frozen->thaw();
+  thawed.addVertex("C");
+  thawed.addEdge("B", "C", 2);
+  EXPECT_EQ(thawed.numEdges(), 2u);
+  EXPECT_EQ(thawed.getEdge("A", "B").value_or(0), 1);
+
+  CountingResource target;
+  {
+    auto moved = frozen->thaw(&target);
+    EXPECT_GT(target.outstanding, 0u);
+    EXPECT_EQ(moved.getEdge("A", "B").value_or(0), 1);
+  }
+  EXPECT_EQ(target.outstanding, 0u);
+}
@@ -0,0 +1,154 @@
+#include "DummyGraphBuilder.hpp"
+#include "gtest/gtest.h"
+#include <algorithm>
+#include <atomic>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+using namespace CinderPeak;
+
+namespace {
+template <typename Row> Row sorted(Row row) {
+  std::sort(row.begin(), row.end());
+  return row;
+}
+} // namespace
+
+TEST(NeighborCacheTest, RepeatedReadsHitTheCache) {
+  CinderGraph<std::string, int> graph;
+  graph.enableNeighborCache(16);
+  graph.addVertex("A");
+  graph.addVertex("B");
+  graph.addEdge("A", "B", 1);
+
+  auto first = graph.getNeighbors("A");
+  auto second = graph.getNeighbors(std::string_view("A"));
+  EXPECT_EQ(first, second);
+  auto stats = graph.neighborCacheStats();
+  EXPECT_EQ(stats.misses, 1u);
+  EXPECT_EQ(stats.hits, 1u);
+  EXPECT_EQ(stats.entries, 1u);
+  EXPECT_EQ(stats.capacity, 16u);
+
+  // Missing vertices are not cached.
+  EXPECT_TRUE(graph.getNeighbors("Z").empty());
+  EXPECT_EQ(graph.neighborCacheStats().entries, 1u);
+}
+
+TEST(NeighborCacheTest, MutationsInvalidateExactlyTheirRows) {
+  CinderGraph<int, int> graph;
+  graph.enableNeighborCache(64);
+  for (int v = 1; v <= 4; ++v)
+    graph.addVertex(v);
+  graph.addEdge(1, 2, 10);
+  graph.addEdge(3, 4, 30);
+  graph.getNeighbors(1);
+  graph.getNeighbors(3);
+
+  graph.addEdge(1, 3, 13);
+  EXPECT_EQ(graph.neighborCacheStats().entries, 1u); // row 3 survives
+  EXPECT_EQ(sorted(graph.getNeighbors(1)),
+            (std::vector<std::pair<int, int>>{{2, 10}, {3, 13}}));
+
+  graph.updateEdge(1, 2, 11);
+  EXPECT_EQ(sorted(graph.getNeighbors(1))[0].second, 11);
+
+  graph.removeEdge(1, 3);
+  EXPECT_EQ(graph.getNeighbors(1).size(), 1u);
+
+  WriteBatch<int, int> batch;
+  batch.addEdge(3, 1, 31).addEdge(3, 3, 0); // the self loop is rejected
+  graph.apply(batch);
+  EXPECT_EQ(graph.getNeighbors(3).size(), 2u);
+
+  // Rows pointing at a removed vertex go too.
+  graph.getNeighbors(1);
+  graph.getNeighbors(3);
+  graph.removeVertex(2);
+  EXPECT_TRUE(graph.getNeighbors(1).empty());
+  EXPECT_EQ(sorted(graph.getNeighbors(3)),
+            (std::vector<std::pair<int, int>>{{1, 31}, {4, 30}}));
+
+  graph.clearEdges();
+  EXPECT_EQ(graph.neighborCacheStats().entries, 0u);
+  EXPECT_TRUE(graph.getNeighbors(3).empty());
+}
+
+TEST(NeighborCacheTest, UndirectedEdgesInvalidateBothEnds) {
+  CinderGraph<int, Unweighted> graph(
+      GraphCreationOptions({GraphCreationOptions::Undirected}));
+  graph.enableNeighborCache(8);
+  graph.addVertex(1);
+  graph.addVertex(2);
+  EXPECT_TRUE(graph.getNeighbors(2).empty());
+  graph.addEdge(1, 2);
+  ASSERT_EQ(graph.getNeighbors(2).size(), 1u);
+  EXPECT_EQ(graph.getNeighbors(2)[0].first, 1);
+  graph.removeEdge(1, 2);
+  EXPECT_TRUE(graph.getNeighbors(2).empty());
+}
+
+TEST(NeighborCacheTest, ClockEvictsColdRows) {
+  PeakStore::NeighborCache<int, int> cache(2);
+  using Row = PeakStore::NeighborCache<int, int>::Row;
+  cache.insert(1, Row{{2, 1}}, cache.epoch());
+  cache.insert(2, Row{{3, 1}}, cache.epoch());
+  ASSERT_TRUE(cache.find(1).has_value()); // 1 is referenced
+  cache.insert(3, Row{{4, 1}}, cache.epoch());
+  EXPECT_TRUE(cache.find(1).has_value());
+  EXPECT_FALSE(cache.find(2).has_value());
+  EXPECT_TRUE(cache.find(3).has_value());
+
+  // A row read before an invalidation is not cached.
+  uint64_t epoch = cache.epoch();
+  cache.invalidate(7);
+  cache.insert(7, Row{}, epoch);
+  EXPECT_FALSE(cache.find(7).has_value());
+  EXPECT_EQ(cache.stats().entries, 2u);
+}
+
+TEST(NeighborCacheTest, ClearKeepsCapacityWhileResizing) {
+  PeakStore::NeighborCache<int, int> cache(4);
+  using Row = PeakStore::NeighborCache<int, int>::Row;
+  cache.insert(1, Row{{2, 1}}, cache.epoch());
+  cache.clear();
+  EXPECT_FALSE(cache.find(1).has_value());
+  EXPECT_EQ(cache.stats().entries, 0u);
+  EXPECT_EQ(cache.capacity(), 4u);
+
+  std::atomic<bool> done{false};
+  std::thread resizer([&] {
+    for (size_t i = 0; i < 200; ++i)
+      cache.resize(i % 2 ? 3 : 8);
+    done = true;
+  });
+  for (int k = 0; !done; ++k) {
+    cache.insert(k % 16, Row{{k, k}}, cache.epoch());
+    cache.clear();
+  }
+  resizer.join();
+  cache.insert(5, Row{{6, 1}}, cache.epoch());
+  EXPECT_EQ(cache.capacity(), 3u);
+  EXPECT_EQ(cache.find(5), Row({{6, 1}}));
+}
+
+TEST(NeighborCacheTest, ReadersNeverSeeStaleRows) {
+  CinderGraph<int, int> graph;
+  graph.enableNeighborCache(32);
+  constexpr int N = 500;
+  for (int v = 0; v <= N; ++v)
+    graph.addVertex(v);
+
+  std::atomic<bool> done{false};
+  std::thread reader([&] {
+    while (!done)
+      graph.getNeighbors(0);
+  });
+  for (int v = 1; v <= N; ++v)
+    graph.addEdge(0, v, v);
+  done = true;
+  reader.join();
+  EXPECT_EQ(graph.getNeighbors(0).size(), static_cast<size_t>(N));
+}
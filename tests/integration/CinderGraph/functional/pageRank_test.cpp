@@ -0,0 +1,112 @@
+#include "DummyGraphBuilder.hpp"
+#include "TestCSR.hpp"
+#include "gtest/gtest.h"
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace CinderPeak;
+using namespace CinderPeak::Algorithms;
+
+namespace {
+// Push-style power iteration in double precision.
+std::vector<double>
+referencePageRank(size_t n, const std::vector<std::pair<size_t, size_t>> &edges,
+                  double damping, int iterations) {
+  std::vector<size_t> degree(n);
+  for (const auto &edge : edges)
+    ++degree[edge.first];
+  std::vector<double> rank(n, 1.0 / static_cast<double>(n));
+  for (int i = 0; i < iterations; ++i) {
+    double dangling = 0;
+    for (size_t v = 0; v < n; ++v)
+      if (degree[v] == 0)
+        dangling += rank[v];
+    std::vector<double> next(
+        n, (1 - damping + damping * dangling) / static_cast<double>(n));
+    for (const auto &[u, v] : edges)
+      next[v] += damping * rank[u] / static_cast<double>(degree[u]);
+    rank = std::move(next);
+  }
+  return rank;
+}
+} // namespace
+
+TEST(PageRankTest, CycleAndDanglingVertices) {
+  CinderGraph<std::string, int> graph;
+  for (const char *v : {"A", "B", "C"})
+    graph.addVertex(v);
+  graph.addEdge("A", "B", 1);
+  graph.addEdge("B", "C", 1);
+  graph.addEdge("C", "A", 1);
+
+  auto cycle = graph.pageRank();
+  ASSERT_TRUE(cycle.isOK());
+  EXPECT_TRUE(cycle.converged_);
+  for (const char *v : {"A", "B", "C"})
+    EXPECT_NEAR(*cycle.rankOf(v), 1.0 / 3, 1e-6);
+  EXPECT_FALSE(cycle.rankOf("Z").has_value());
+
+  // D only receives rank: it is dangling and gives it back to everyone.
+  graph.addVertex("D");
+  graph.addEdge("A", "D", 1);
+  auto result = graph.pageRank(0.85, 1e-7, 200);
+  ASSERT_TRUE(result.converged_);
+  EXPECT_EQ(result.iterationSeconds_.size(), result.iterations_);
+  EXPECT_NEAR(std::accumulate(result.ranks_.begin(), result.ranks_.end(), 0.0),
+              1.0, 1e-5);
+
+  std::vector<std::pair<size_t, size_t>> edges;
+  for (auto [src, dest] : {std::pair<const char *, const char *>{"A", "B"},
+                           {"B", "C"},
+                           {"C", "A"},
+                           {"A", "D"}})
+    edges.emplace_back(*result.index(src), *result.index(dest));
+  auto expected = referencePageRank(4, edges, 0.85, 200);
+  for (size_t v = 0; v < 4; ++v)
+    EXPECT_NEAR(result.ranks_[v], expected[v], 1e-5);
+
+  EXPECT_FALSE(graph.pageRank(1.5).isOK());
+}
+
+TEST(PageRankTest, ParallelMatchesReference) {
+  std::mt19937 rng(4);
+  for (size_t n : {1u, 40u, 3000u}) {
+    auto edges = randomEdges(rng, n, 5 * n);
+    // Every fifth vertex stays dangling.
+    edges.erase(std::remove_if(edges.begin(), edges.end(),
+                               [](const auto &e) { return e.first % 5 == 0; }),
+                edges.end());
+    TestCSR csr(n, edges);
+    CSRView g = csr.view();
+
+    auto expected = referencePageRank(n, edges, 0.85, 100);
+    forEachWorkerCount<PageRankOptions>([&](PageRankOptions options) {
+      options.tolerance = 1e-7;
+      PageRankScores scores = pageRank(g, options);
+      EXPECT_TRUE(scores.converged);
+      for (size_t v = 0; v < n; ++v)
+        EXPECT_NEAR(scores.rank[v], expected[v], 1e-6);
+    });
+  }
+}
+
+TEST(PageRankTest, UndirectedGraphsUseBothDirections) {
+  CinderGraph<int, Unweighted> graph(
+      GraphCreationOptions({GraphCreationOptions::Undirected}));
+  for (int v = 0; v < 5; ++v)
+    graph.addVertex(v);
+  for (int v = 1; v < 5; ++v)
+    graph.addEdge(0, v); // a star: the hub collects the most rank
+
+  auto result = graph.pageRank();
+  ASSERT_TRUE(result.isOK());
+  for (int v = 1; v < 5; ++v) {
+    EXPECT_GT(*result.rankOf(0), *result.rankOf(v));
+    EXPECT_NEAR(*result.rankOf(v), *result.rankOf(1), 1e-6);
+  }
+}
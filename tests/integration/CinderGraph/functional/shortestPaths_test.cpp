@@ -0,0 +1,147 @@
+#include "DummyGraphBuilder.hpp"
+#include "TestCSR.hpp"
+#include "gtest/gtest.h"
+#include <random>
+#include <set>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+using namespace CinderPeak;
+using namespace CinderPeak::Algorithms;
+
+namespace {
+template <typename W> void expectDeltaSteppingMatchesDijkstra(W scale) {
+  std::mt19937 rng(3);
+  for (size_t n : {1u, 80u, 1500u}) {
+    for (double avgDegree : {1.2, 10.0}) {
+      std::uniform_int_distribution<size_t> pick(0, n - 1);
+      std::uniform_int_distribution<int> weight(0, 40);
+      std::vector<std::tuple<size_t, size_t, W>> edges;
+      const size_t count =
+          static_cast<size_t>(static_cast<double>(n) * avgDegree);
+      for (size_t i = 0; i < count; ++i)
+        edges.emplace_back(pick(rng), pick(rng),
+                           static_cast<W>(weight(rng)) / scale);
+      TestCSR<W> csr(n, edges);
+      CSRView g = csr.view();
+
+      auto expected = dijkstra(g, csr.weights.data(), 0);
+      for (DeltaSteppingOptions options :
+           {DeltaSteppingOptions{}, DeltaSteppingOptions{1, 3, 1},
+            DeltaSteppingOptions{25, 2, 1}}) {
+        auto tree = deltaStepping(g, csr.weights.data(), 0, options);
+        ASSERT_EQ(tree.distance, expected.distance);
+        for (size_t v = 1; v < n; ++v) {
+          size_t p = tree.predecessor[v];
+          if (p == UNREACHED)
+            continue;
+          bool tight = false;
+          for (size_t e = g.offsets[p]; e < g.offsets[p + 1]; ++e)
+            tight |= g.targets[e] == v &&
+                     tree.distance[p] + csr.weights[e] == tree.distance[v];
+          EXPECT_TRUE(tight);
+        }
+      }
+    }
+  }
+}
+} // namespace
+
+TEST(ShortestPathsTest, DijkstraDistancesAndPaths) {
+  CinderGraph<std::string, int> graph;
+  for (const char *v : {"A", "B", "C", "D", "E"})
+    graph.addVertex(v);
+  graph.addEdge("A", "B", 4);
+  graph.addEdge("A", "C", 1);
+  graph.addEdge("C", "B", 2);
+  graph.addEdge("B", "D", 5);
+  graph.addEdge("C", "D", 8);
+
+  auto result = graph.shortestPaths("A");
+  ASSERT_TRUE(result.isOK());
+  EXPECT_EQ(result.distanceTo("A"), 0);
+  EXPECT_EQ(result.distanceTo("B"), 3);
+  EXPECT_EQ(result.distanceTo("D"), 8);
+  EXPECT_EQ(result.pathTo("D"),
+            (std::vector<std::string>{"A", "C", "B", "D"}));
+  EXPECT_FALSE(result.distanceTo("E").has_value());
+  EXPECT_TRUE(result.pathTo("E").empty());
+  EXPECT_FALSE(result.distanceTo("Z").has_value());
+
+  // The dense arrays line up with vertex().
+  size_t b = *result.index("B");
+  EXPECT_EQ(result.vertex(b), "B");
+  EXPECT_EQ(result.vertex(result.predecessor_[b]), "C");
+
+  EXPECT_FALSE(graph.shortestPaths("Z").isOK());
+
+  // Runs on an unchanged graph share one vertex table; a mutation leaves
+  // the older result's table intact.
+  auto again = graph.pageRank();
+  EXPECT_EQ(&again.vertex(0), &result.vertex(0));
+  graph.addVertex("F");
+  auto after = graph.shortestPaths("A");
+  EXPECT_NE(&after.vertex(0), &result.vertex(0));
+  EXPECT_EQ(after.size(), 6u);
+  EXPECT_EQ(result.size(), 5u);
+  EXPECT_EQ(result.vertex(b), "B");
+}
+
+TEST(ShortestPathsTest, SeesWeightUpdates) {
+  CinderGraph<int, double> graph(
+      GraphCreationOptions({GraphCreationOptions::Undirected}));
+  for (int v = 1; v <= 3; ++v)
+    graph.addVertex(v);
+  graph.addEdge(1, 2, 1.5);
+  graph.addEdge(2, 3, 1.5);
+  graph.addEdge(1, 3, 5.0);
+  EXPECT_EQ(graph.shortestPaths(3).distanceTo(1), 3.0);
+
+  graph.updateEdge(1, 3, 2.0);
+  EXPECT_EQ(graph.shortestPaths(3).distanceTo(1), 2.0);
+  EXPECT_EQ(graph.parallelShortestPaths(3).distanceTo(1), 2.0);
+
+  graph.updateEdge(1, 2, -1.0);
+  auto rejected = graph.shortestPaths(1);
+  EXPECT_FALSE(rejected.isOK());
+  EXPECT_EQ(rejected._status.code(), StatusCode::INVALID_ARGUMENT);
+}
+
+TEST(ShortestPathsTest, DeltaSteppingMatchesDijkstra) {
+  expectDeltaSteppingMatchesDijkstra<int>(1);
+  expectDeltaSteppingMatchesDijkstra<unsigned>(1);
+  expectDeltaSteppingMatchesDijkstra<double>(8.0);
+}
+
+TEST(ShortestPathsTest, ParallelShortestPathsThroughTheGraph) {
+  CinderGraph<int, int> graph;
+  std::mt19937 rng(9);
+  std::uniform_int_distribution<int> pick(0, 299);
+  std::uniform_int_distribution<int> weight(1, 20);
+  for (int v = 0; v < 300; ++v)
+    graph.addVertex(v);
+  std::set<std::pair<int, int>> seen; // keep getEdge() unambiguous
+  for (int i = 0; i < 1500; ++i) {
+    int u = pick(rng), v = pick(rng);
+    if (u != v && seen.emplace(u, v).second)
+      graph.addEdge(u, v, weight(rng));
+  }
+
+  auto serial = graph.shortestPaths(0);
+  auto parallel = graph.parallelShortestPaths(0, DeltaSteppingOptions{4, 3, 1});
+  ASSERT_TRUE(parallel.isOK());
+  EXPECT_EQ(parallel.distance_, serial.distance_);
+  for (int v = 0; v < 300; ++v) {
+    auto path = parallel.pathTo(v);
+    if (!serial.distanceTo(v)) {
+      EXPECT_TRUE(path.empty());
+      continue;
+    }
+    int length = 0;
+    for (size_t i = 1; i < path.size(); ++i)
+      length += *graph.getEdge(path[i - 1], path[i]);
+    EXPECT_EQ(length, *serial.distanceTo(v));
+  }
+}
@@ -0,0 +1,164 @@
+#include "DummyGraphBuilder.hpp"
+#include "gtest/gtest.h"
+#include <algorithm>
+#include <atomic>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <vector>
+
+using namespace CinderPeak;
+
+namespace {
+template <typename V, typename E>
+std::vector<std::tuple<V, V, E>>
+sortedEdges(std::vector<std::tuple<V, V, E>> e) {
+  std::sort(e.begin(), e.end());
+  return e;
+}
+} // namespace
+
+TEST(SnapshotTest, IgnoresWritesMadeAfterIt) {
+  CinderGraph<int, int> graph;
+  for (int v = 1; v <= 4; ++v)
+    graph.addVertex(v);
+  graph.addEdge(1, 2, 10);
+  graph.addEdge(2, 3, 20);
+  auto before = sortedEdges(graph.edges());
+
+  auto snap = graph.snapshot();
+  graph.addEdge(3, 4, 30);
+  graph.updateEdge(1, 2, 11);
+  graph.removeEdge(2, 3);
+  graph.removeVertex(1);
+  graph.addVertex(5); // reuses the id freed by vertex 1
+  graph.addEdge(5, 4, 50);
+
+  EXPECT_EQ(snap.numVertices(), 4u);
+  EXPECT_EQ(snap.numEdges(), 2u);
+  EXPECT_TRUE(snap.hasVertex(1));
+  EXPECT_FALSE(snap.hasVertex(5));
+  EXPECT_EQ(snap.getEdge(1, 2), 10);
+  EXPECT_EQ(snap.getEdge(2, 3), 20);
+  EXPECT_FALSE(snap.getEdge(3, 4).has_value());
+  EXPECT_FALSE(snap.getEdge(5, 4).has_value());
+  ASSERT_EQ(snap.getNeighbors(1).size(), 1u);
+  EXPECT_EQ(snap.getNeighbors(1)[0].first, 2);
+
+  auto vertices = snap.vertices();
+  std::sort(vertices.begin(), vertices.end());
+  EXPECT_EQ(vertices, (std::vector<int>{1, 2, 3, 4}));
+  EXPECT_EQ(sortedEdges(snap.edges()), before);
+
+  // The live graph moved on.
+  EXPECT_FALSE(graph.hasVertex(1));
+  EXPECT_EQ(graph.getEdge(5, 4), 50);
+}
+
+TEST(SnapshotTest, EachSnapshotKeepsItsOwnVersion) {
+  CinderGraph<std::string, int> graph;
+  graph.addVertex("A");
+  graph.addVertex("B");
+  graph.addEdge("A", "B", 1);
+
+  auto first = graph.snapshot();
+  graph.updateEdge("A", "B", 2);
+  auto second = graph.snapshot();
+  graph.updateEdge("A", "B", 3);
+
+  EXPECT_LT(first.sequence(), second.sequence());
+  EXPECT_EQ(first.getEdge("A", "B"), 1);
+  EXPECT_EQ(second.getEdge("A", "B"), 2);
+  EXPECT_EQ(graph.getEdge("A", "B"), 3);
+}
+
+TEST(SnapshotTest, SurvivesBulkRewrites) {
+  CinderGraph<int, Unweighted> graph(
+      GraphCreationOptions({GraphCreationOptions::Undirected}));
+  for (int v = 1; v <= 3; ++v)
+    graph.addVertex(v);
+  graph.addEdge(1, 2);
+  graph.addEdge(2, 3);
+
+  auto snap = graph.snapshot();
+  graph.clearEdges();
+  graph.clearVertices();
+  graph.addVertex(7);
+
+  EXPECT_EQ(snap.numEdges(), 4u);
+  EXPECT_TRUE(snap.getEdge(2, 1).has_value());
+  EXPECT_TRUE(snap.getEdge(3, 2).has_value());
+  EXPECT_FALSE(snap.hasVertex(7));
+  EXPECT_EQ(snap.vertices().size(), 3u);
+  EXPECT_EQ(snap.edges().size(), 4u);
+}
+
+TEST(SnapshotTest, KeepsStringVerticesAcrossRemovals) {
+  CinderGraph<std::string, int> graph;
+  graph.addVertex("A");
+  graph.addVertex("B");
+  graph.addEdge("A", "B", 1);
+
+  auto snap = graph.snapshot();
+  graph.removeVertex("B");
+  graph.addVertex("C");
+  EXPECT_TRUE(snap.hasVertex(std::string_view("B")));
+  EXPECT_FALSE(snap.hasVertex("C"));
+  EXPECT_EQ(snap.getEdge("A", std::string_view("B")), 1);
+
+  graph.clearVertices();
+  graph.addVertex("B");
+  EXPECT_TRUE(snap.hasVertex("A"));
+  EXPECT_FALSE(snap.hasVertex("C"));
+  EXPECT_EQ(snap.getEdge("A", "B"), 1);
+}
+
+TEST(SnapshotTest, StateIsReleasedWithLastHandle) {
+  GraphRuntime runtime;
+  PeakStore::AdjacencyList<int, int> storage(runtime);
+  (void)storage.impl_addVertex(1);
+  (void)storage.impl_addVertex(2);
+  {
+    auto state = storage.openSnapshot();
+    auto copy = state;
+    EXPECT_EQ(storage.openSnapshotCount(), 1u);
+    (void)storage.impl_addEdge(1, 2, 5);
+    EXPECT_EQ(state->rows.size(), 1u); // pre-image of row 1
+  }
+  EXPECT_EQ(storage.openSnapshotCount(), 0u);
+  EXPECT_TRUE(storage.impl_updateEdge(1, 2, 6).isOK());
+}
+
+TEST(SnapshotTest, ScansWhileWritersRun) {
+  CinderGraph<int, int> graph;
+  constexpr int N = 2000;
+  for (int v = 0; v < N; ++v)
+    graph.addVertex(v);
+  for (int v = 0; v + 1 < N; ++v)
+    graph.addEdge(v, v + 1, v);
+
+  auto snap = graph.snapshot();
+  std::atomic<bool> done{false};
+  std::thread writer([&] {
+    for (int v = 0; v + 1 < N; ++v) {
+      graph.updateEdge(v, v + 1, -v);
+      graph.addEdge(v + 1, v, v);
+    }
+    for (int v = 0; v < N; v += 2)
+      graph.removeVertex(v);
+    done = true;
+  });
+  size_t scans = 0;
+  do {
+    auto edges = snap.edges();
+    ASSERT_EQ(edges.size(), static_cast<size_t>(N - 1));
+    for (const auto &[src, dest, weight] : edges) {
+      ASSERT_EQ(dest, src + 1);
+      ASSERT_EQ(weight, src);
+    }
+    ++scans;
+  } while (!done);
+  writer.join();
+  EXPECT_GE(scans, 1u);
+  EXPECT_EQ(snap.vertices().size(), static_cast<size_t>(N));
+}
@@ -0,0 +1,48 @@
+#include "CinderPeak.hpp"
+#include "gtest/gtest.h"
+#include <type_traits>
+
+using namespace CinderPeak;
+
+static_assert(std::is_same_v<PeakStore::PeakStore<int, int>::Storage,
+                             PeakStorageInterface<int, int>>,
+              "DynamicStorage must stay the default");
+static_assert(
+    std::is_same_v<PeakStore::PeakStore<int, int, AdjacencyStorage>::Storage,
+                   PeakStore::AdjacencyList<int, int>>,
+    "AdjacencyStorage binds AdjacencyList statically");
+
+template <typename Policy> class StoragePolicyTest : public ::testing::Test {};
+using Policies = ::testing::Types<DynamicStorage, AdjacencyStorage>;
+TYPED_TEST_SUITE(StoragePolicyTest, Policies);
+
+TYPED_TEST(StoragePolicyTest, CoreOperationsBehaveTheSame) {
+  CinderGraph<int, int, TypeParam> graph;
+  for (int v = 1; v <= 3; ++v)
+    EXPECT_TRUE(graph.addVertex(v).second);
+  EXPECT_FALSE(graph.addVertex(1).second);
+
+  EXPECT_TRUE(graph.addEdge(1, 2, 5).second);
+  EXPECT_TRUE(graph.addEdge(2, 3, 7).second);
+  EXPECT_FALSE(graph.addEdge(1, 2, 5).second);
+  EXPECT_TRUE(graph.hasVertex(3));
+  EXPECT_EQ(graph.getEdge(1, 2).value_or(0), 5);
+
+  EXPECT_TRUE(graph.updateEdge(2, 3, 9).second);
+  EXPECT_EQ(graph[2][3], 9);
+  EXPECT_TRUE(graph.removeEdge(1, 2).second);
+  EXPECT_EQ(graph.numEdges(), 1u);
+  EXPECT_TRUE(graph.removeVertex(1));
+  EXPECT_EQ(graph.numVertices(), 2u);
+}
+
+TYPED_TEST(StoragePolicyTest, BulkAndBatchPathsUseThePolicy) {
+  std::vector<std::tuple<int, int, int>> edges = {{1, 2, 1}, {2, 3, 2}};
+  auto graph = CinderGraph<int, int, TypeParam>::fromEdges(edges);
+  WriteBatch<int, int> batch;
+  batch.addVertex(4).addEdge(3, 4, 3);
+  EXPECT_TRUE(graph.apply(batch).allApplied());
+  EXPECT_EQ(graph.numVertices(), 4u);
+  EXPECT_EQ(graph.numEdges(), 3u);
+  EXPECT_EQ(graph.getEdge(3, 4).value_or(0), 3);
+}
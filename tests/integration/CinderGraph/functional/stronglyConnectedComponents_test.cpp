@@ -0,0 +1,107 @@
+#include "DummyGraphBuilder.hpp"
+#include "TestCSR.hpp"
+#include "gtest/gtest.h"
+#include <random>
+#include <utility>
+#include <vector>
+
+using namespace CinderPeak;
+using namespace CinderPeak::Algorithms;
+
+namespace {
+// Same component exactly when each vertex reaches the other.
+void expectMutualReachability(const CSRView &g,
+                              const std::vector<size_t> &component) {
+  const size_t n = g.vertices;
+  std::vector<std::vector<bool>> reaches(n, std::vector<bool>(n));
+  for (size_t s = 0; s < n; ++s) {
+    std::vector<size_t> stack{s};
+    reaches[s][s] = true;
+    while (!stack.empty()) {
+      size_t u = stack.back();
+      stack.pop_back();
+      for (size_t e = g.offsets[u]; e < g.offsets[u + 1]; ++e)
+        if (!reaches[s][g.targets[e]]) {
+          reaches[s][g.targets[e]] = true;
+          stack.push_back(g.targets[e]);
+        }
+    }
+  }
+  for (size_t a = 0; a < n; ++a)
+    for (size_t b = 0; b < n; ++b)
+      ASSERT_EQ(reaches[a][b] && reaches[b][a], component[a] == component[b])
+          << a << " " << b;
+}
+} // namespace
+
+TEST(StronglyConnectedComponentsTest, CyclesAndCondensation) {
+  CinderGraph<int, Unweighted> graph;
+  for (int v = 0; v < 7; ++v)
+    graph.addVertex(v);
+  // Two cycles {0, 1, 2} and {3, 4} joined by 2 -> 3 and 1 -> 4; 5 hangs
+  // off the second, 6 is isolated.
+  for (auto [u, v] : {std::pair<int, int>{0, 1},
+                      {1, 2},
+                      {2, 0},
+                      {2, 3},
+                      {1, 4},
+                      {3, 4},
+                      {4, 3},
+                      {4, 5}})
+    graph.addEdge(u, v);
+
+  for (const auto &result :
+       {graph.stronglyConnectedComponents(),
+        graph.parallelStronglyConnectedComponents()}) {
+    ASSERT_TRUE(result.isOK());
+    EXPECT_EQ(result.count(), 4u);
+    EXPECT_TRUE(result.sameComponent(0, 2));
+    EXPECT_TRUE(result.sameComponent(3, 4));
+    EXPECT_FALSE(result.sameComponent(2, 3));
+    EXPECT_EQ(result.sizes_[*result.componentOf(1)], 3u);
+
+    size_t cycle = *result.componentOf(0), pair = *result.componentOf(3);
+    size_t tail = *result.componentOf(5), alone = *result.componentOf(6);
+    EXPECT_EQ(result.successors(cycle), std::vector<size_t>{pair});
+    EXPECT_EQ(result.successors(pair), std::vector<size_t>{tail});
+    EXPECT_TRUE(result.successors(tail).empty());
+    EXPECT_TRUE(result.successors(alone).empty());
+  }
+}
+
+TEST(StronglyConnectedComponentsTest, DeepChainDoesNotRecurse) {
+  // A single cycle through 200k vertices would overflow a recursive
+  // Tarjan's stack.
+  const size_t n = 200000;
+  std::vector<std::pair<size_t, size_t>> edges;
+  for (size_t v = 0; v < n; ++v)
+    edges.emplace_back(v, (v + 1) % n);
+  TestCSR csr(n, edges);
+  StrongComponents scc = stronglyConnectedComponents(csr.view());
+  EXPECT_EQ(scc.sizes, std::vector<size_t>{n});
+  EXPECT_TRUE(scc.dagTargets.empty());
+}
+
+TEST(StronglyConnectedComponentsTest, ParallelMatchesTarjan) {
+  std::mt19937 rng(12);
+  for (size_t n : {1u, 60u, 400u}) {
+    for (size_t degree : {1u, 2u, 4u}) {
+      TestCSR csr(n, randomEdges(rng, n, degree * n));
+      CSRView g = csr.view();
+
+      StrongComponents expected = stronglyConnectedComponents(g);
+      expectMutualReachability(g, expected.component);
+      forEachWorkerCount<SCCOptions>([&](SCCOptions options) {
+        for (size_t cutoff : {0u, 16u}) {
+          options.serialCutoff = cutoff;
+          StrongComponents scc =
+              parallelStronglyConnectedComponents(g, options);
+          EXPECT_EQ(scc.component, expected.component);
+          EXPECT_EQ(scc.sizes, expected.sizes);
+          EXPECT_EQ(scc.dagOffsets, expected.dagOffsets);
+          EXPECT_EQ(scc.dagTargets, expected.dagTargets);
+        }
+      });
+    }
+  }
+}
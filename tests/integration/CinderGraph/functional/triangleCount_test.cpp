@@ -0,0 +1,107 @@
+#include "DummyGraphBuilder.hpp"
+#include "TestCSR.hpp"
+#include "gtest/gtest.h"
+#include <algorithm>
+#include <random>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace CinderPeak;
+using namespace CinderPeak::Algorithms;
+
+TEST(TriangleCountTest, CountsAndClustering) {
+  CinderGraph<std::string, int> graph(
+      GraphCreationOptions({GraphCreationOptions::Undirected}));
+  for (const char *v : {"A", "B", "C", "D", "E"})
+    graph.addVertex(v);
+  // Triangles ABC and ACD share the edge AC; E hangs off A.
+  for (auto [u, v] : {std::pair<const char *, const char *>{"A", "B"},
+                      {"B", "C"},
+                      {"A", "C"},
+                      {"C", "D"},
+                      {"A", "D"},
+                      {"A", "E"}})
+    graph.addEdge(u, v, 1);
+
+  auto result = graph.countTriangles();
+  ASSERT_TRUE(result.isOK());
+  EXPECT_EQ(result.total_, 2u);
+  EXPECT_EQ(*result.trianglesOf("A"), 2u);
+  EXPECT_EQ(*result.trianglesOf("B"), 1u);
+  EXPECT_EQ(*result.trianglesOf("E"), 0u);
+  EXPECT_FALSE(result.trianglesOf("Z").has_value());
+  // A has 4 neighbors, so 6 pairs, 2 of them adjacent.
+  EXPECT_DOUBLE_EQ(*result.clusteringOf("A"), 2.0 / 6);
+  EXPECT_DOUBLE_EQ(*result.clusteringOf("B"), 1.0);
+  EXPECT_DOUBLE_EQ(*result.clusteringOf("E"), 0.0);
+  EXPECT_DOUBLE_EQ(result.averageClustering(),
+                   (2.0 / 6 + 1 + 2.0 / 3 + 1 + 0) / 5);
+}
+
+TEST(TriangleCountTest, DirectedGraphsIgnoreDirection) {
+  CinderGraph<int, Unweighted> graph;
+  for (int v = 0; v < 4; ++v)
+    graph.addVertex(v);
+  // 0 -> 1 -> 2 -> 0 and 0 -> 2 form one undirected triangle; 3 <-> 0 adds
+  // a reciprocal pair but no triangle.
+  graph.addEdge(0, 1);
+  graph.addEdge(1, 2);
+  graph.addEdge(2, 0);
+  graph.addEdge(0, 2);
+  graph.addEdge(3, 0);
+  graph.addEdge(0, 3);
+
+  auto result = graph.countTriangles();
+  ASSERT_TRUE(result.isOK());
+  EXPECT_EQ(result.total_, 1u);
+  EXPECT_EQ(result.triangles_[*result.index(1)], 1u);
+  EXPECT_EQ(*result.trianglesOf(3), 0u);
+  EXPECT_DOUBLE_EQ(*result.clusteringOf(0), 1.0 / 3);
+}
+
+TEST(TriangleCountTest, ParallelMatchesBruteForce) {
+  std::mt19937 rng(21);
+  for (size_t n : {1u, 50u, 600u}) {
+    auto edges = randomEdges(rng, n, 6 * n);
+    // A hub adjacent to half the graph makes the galloping path run.
+    for (const auto &edge : randomEdges(rng, n, n / 2))
+      edges.emplace_back(0, edge.second);
+    std::sort(edges.begin(), edges.end());
+
+    TestCSR csr(n, edges);
+    CSRView g = csr.view();
+
+    std::vector<std::set<size_t>> adjacent(n);
+    for (const auto &[u, v] : edges)
+      if (u != v) {
+        adjacent[u].insert(v);
+        adjacent[v].insert(u);
+      }
+    std::vector<size_t> expected(n);
+    size_t total = 0;
+    for (size_t a = 0; a < n; ++a)
+      for (size_t b : adjacent[a])
+        for (size_t c : adjacent[b])
+          if (a < b && b < c && adjacent[a].count(c)) {
+            ++expected[a];
+            ++expected[b];
+            ++expected[c];
+            ++total;
+          }
+
+    forEachWorkerCount<TriangleOptions>([&](const TriangleOptions &options) {
+      TriangleCounts counts = countTriangles(g, options);
+      EXPECT_EQ(counts.total, total);
+      EXPECT_EQ(counts.triangles, expected);
+      for (size_t v = 0; v < n; ++v) {
+        double d = static_cast<double>(adjacent[v].size());
+        double pairs = d * (d - 1) / 2;
+        EXPECT_DOUBLE_EQ(counts.clustering[v],
+                         pairs > 0 ? static_cast<double>(expected[v]) / pairs
+                                   : 0.0);
+      }
+    });
+  }
+}
@@ -0,0 +1,82 @@
+#include "DummyGraphBuilder.hpp"
+#include "StorageEngine/AdjacencyList.hpp"
+#include "StorageEngine/HybridCSR_COO.hpp"
+#include "gtest/gtest.h"
+#include <atomic>
+#include <thread>
+
+using namespace CinderPeak;
+
+class UndirectedEdgePairTest : public ::testing::Test {
+protected:
+  DummyGraph builder;
+};
+
+TEST_F(UndirectedEdgePairTest, AddUpdateRemoveTouchBothDirections) {
+  auto graph = builder.CreatePrimitiveWeightedGraph(GraphOpts::undirected);
+  for (int v = 1; v <= 3; ++v)
+    EXPECT_TRUE(graph.addVertex(v).second);
+
+  EXPECT_TRUE(graph.addEdge(1, 2, 10).second);
+  EXPECT_EQ(graph.getEdge(2, 1).value_or(0), 10);
+  // Stored once per direction.
+  EXPECT_EQ(graph.numEdges(), 2u);
+  // The reverse edge already exists, so this is a duplicate.
+  EXPECT_FALSE(graph.addEdge(2, 1, 10).second);
+
+  auto [old_weight, updated] = graph.updateEdge(2, 1, 30);
+  EXPECT_TRUE(updated);
+  EXPECT_EQ(old_weight, 10);
+  EXPECT_EQ(graph.getEdge(1, 2).value_or(0), 30);
+
+  EXPECT_TRUE(graph.removeEdge(1, 2).second);
+  EXPECT_FALSE(graph.getEdge(2, 1).has_value());
+  EXPECT_EQ(graph.numEdges(), 0u);
+  EXPECT_FALSE(graph.removeEdge(2, 1).second);
+  EXPECT_EQ(graph.numEdges(), 0u);
+}
+
+TEST(AdjacencyEdgePairTest, ReadersNeverSeeHalfAnEdge) {
+  GraphRuntime runtime;
+  PeakStore::AdjacencyList<int, int> graph(runtime);
+  (void)graph.impl_addVertex(1);
+  (void)graph.impl_addVertex(2);
+
+  std::atomic<bool> stop{false};
+  std::atomic<int> torn{0};
+  std::thread reader([&] {
+    while (!stop.load()) {
+      // The edge list is taken under one lock, so it must hold either both
+      // directions or neither.
+      if (graph.impl_getEdgeList().size() % 2 != 0)
+        torn.fetch_add(1);
+    }
+  });
+  for (int i = 0; i < 2000; ++i) {
+    EXPECT_TRUE(graph.impl_addEdgePair(1, 2, i, {true, false}).isOK());
+    EXPECT_TRUE(graph.impl_removeEdgePair(2, 1).second.isOK());
+  }
+  stop.store(true);
+  reader.join();
+  EXPECT_EQ(torn.load(), 0);
+}
+
+TEST(HybridEdgePairTest, PairOperationsOnCooAndCsr) {
+  PeakStore::HybridCSR_COO<int, int> graph;
+  for (int v = 1; v <= 3; ++v)
+    (void)graph.impl_addVertex(v);
+
+  EXPECT_TRUE(graph.impl_addEdgePair(1, 2, 4, {true, false}).isOK());
+  graph.orchestrator_buildIfNeeded();
+  EXPECT_TRUE(graph.impl_addEdgePair(2, 3, 6, {true, false}).isOK());
+
+  EXPECT_TRUE(graph.impl_updateEdgePair(2, 1, 8).isOK());
+  EXPECT_EQ(graph.impl_getEdge(1, 2).first, 8);
+
+  auto [weight, status] = graph.impl_removeEdgePair(3, 2);
+  EXPECT_TRUE(status.isOK());
+  EXPECT_EQ(weight, 6);
+  EXPECT_FALSE(graph.impl_doesEdgeExist(2, 3));
+  EXPECT_TRUE(graph.impl_doesEdgeExist(1, 2));
+  EXPECT_TRUE(graph.impl_doesEdgeExist(2, 1));
+}
@@ -0,0 +1,222 @@
+#include "DummyGraphBuilder.hpp"
+#include "TempFileTest.hpp"
+#include "gtest/gtest.h"
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <vector>
+
+using namespace CinderPeak;
+
+namespace {
+class WriteAheadLogTest : public TempFileTest {};
+} // namespace
+
+TEST_F(WriteAheadLogTest, ReplayRebuildsTheGraph) {
+  std::vector<std::tuple<int, int, int>> expected;
+  {
+    CinderGraph<int, int> graph;
+    EXPECT_EQ(graph.enableWriteAheadLog(path), 0u);
+    for (int v = 1; v <= 4; ++v)
+      graph.addVertex(v);
+    graph.addEdge(1, 2, 10);
+    graph.addEdge(2, 3, 20);
+    graph.addEdge(3, 4, 30);
+    graph.updateEdge(1, 2, 11);
+    graph.removeEdge(2, 3);
+    graph.addVertex(2);     // fails, so it is not logged
+    graph.addEdge(4, 4, 1); // self loop, rejected
+    graph.removeVertex(4);
+    expected = sortedEdges(graph);
+  }
+
+  CinderGraph<int, int> restored;
+  EXPECT_EQ(restored.enableWriteAheadLog(path), 10u);
+  EXPECT_EQ(restored.numVertices(), 3u);
+  EXPECT_EQ(sortedEdges(restored), expected);
+  EXPECT_EQ(restored.getEdge(1, 2), 11);
+}
+
+TEST_F(WriteAheadLogTest, ReplaysBatchesAndClears) {
+  GraphCreationOptions undirected({GraphCreationOptions::Undirected});
+  {
+    CinderGraph<std::string, Unweighted> graph(undirected);
+    graph.enableWriteAheadLog(path);
+    graph.addVertex("X");
+    graph.clearVertices();
+    WriteBatch<std::string, Unweighted> batch;
+    batch.addVertex("A").addVertex("B").addVertex("C");
+    batch.addEdge("A", "B").addEdge("A", "Z").addEdge("B", "C");
+    graph.apply(batch);
+    graph.clearEdges();
+    graph.addEdge("C", "A");
+  }
+
+  CinderGraph<std::string, Unweighted> restored(undirected);
+  EXPECT_EQ(restored.enableWriteAheadLog(path), 5u);
+  EXPECT_FALSE(restored.hasVertex("X"));
+  EXPECT_EQ(restored.numVertices(), 3u);
+  EXPECT_EQ(restored.numEdges(), 2u);
+  EXPECT_TRUE(restored.getEdge("A", "C").has_value());
+  EXPECT_FALSE(restored.getEdge("A", "B").has_value());
+}
+
+TEST_F(WriteAheadLogTest, TornTailIsDropped) {
+  {
+    CinderGraph<int, int> graph;
+    graph.enableWriteAheadLog(path);
+    graph.addVertex(1);
+    graph.addVertex(2);
+    graph.addEdge(1, 2, 5);
+  }
+  const auto intact = std::filesystem::file_size(path);
+  {
+    // Half of a frame header plus garbage, as a crash mid-write leaves it.
+    std::ofstream out(path, std::ios::binary | std::ios::app);
+    out.write("\x40\x00\x00\x00\x12\x34", 6);
+  }
+
+  CinderGraph<int, int> restored;
+  EXPECT_EQ(restored.enableWriteAheadLog(path), 3u);
+  EXPECT_EQ(std::filesystem::file_size(path), intact);
+  EXPECT_EQ(restored.getEdge(1, 2), 5);
+  restored.addVertex(3);
+  restored.disableWriteAheadLog();
+
+  CinderGraph<int, int> again;
+  EXPECT_EQ(again.enableWriteAheadLog(path), 4u);
+  EXPECT_TRUE(again.hasVertex(3));
+}
+
+TEST_F(WriteAheadLogTest, OversizedLengthIsTorn) {
+  {
+    CinderGraph<int, int> graph;
+    graph.enableWriteAheadLog(path);
+    graph.addVertex(1);
+  }
+  const auto intact = std::filesystem::file_size(path);
+  {
+    // A whole header whose length claims ~4 GiB, then a few stray bytes.
+    std::ofstream out(path, std::ios::binary | std::ios::app);
+    out.write("\xf0\xff\xff\xff\x00\x00\x00\x00garbage", 15);
+  }
+
+  CinderGraph<int, int> restored;
+  EXPECT_EQ(restored.enableWriteAheadLog(path), 1u);
+  EXPECT_EQ(std::filesystem::file_size(path), intact);
+  EXPECT_TRUE(restored.hasVertex(1));
+}
+
+TEST_F(WriteAheadLogTest, LargeBatchesSplitIntoFrames) {
+  WalOptions options;
+  options.maxFrameBytes = 64;
+  std::vector<std::tuple<int, int, int>> expected;
+  {
+    CinderGraph<int, int> graph;
+    graph.enableWriteAheadLog(path, options);
+    WriteBatch<int, int> batch;
+    for (int v = 0; v < 50; ++v)
+      batch.addVertex(v);
+    for (int v = 0; v < 49; ++v)
+      batch.addEdge(v, v + 1, v * 3);
+    EXPECT_TRUE(graph.apply(batch).firstError.isOK());
+    expected = sortedEdges(graph);
+  }
+
+  // 887 bytes of ops, at most 64 body bytes per frame.
+  CinderGraph<int, int> restored;
+  EXPECT_GT(restored.enableWriteAheadLog(path), 10u);
+  EXPECT_EQ(restored.numVertices(), 50u);
+  EXPECT_EQ(sortedEdges(restored), expected);
+}
+
+TEST_F(WriteAheadLogTest, OversizedOperationFailsTheWrite) {
+  WalOptions options;
+  options.maxFrameBytes = 64;
+  const std::string big(100, 'x');
+  {
+    CinderGraph<std::string, Unweighted> graph;
+    graph.enableWriteAheadLog(path, options);
+    WriteBatch<std::string, Unweighted> batch;
+    batch.addVertex("A").addVertex(big).addVertex("B");
+    EXPECT_FALSE(graph.apply(batch).firstError.isOK());
+  }
+
+  // The ops around the oversized one are still logged.
+  CinderGraph<std::string, Unweighted> restored;
+  EXPECT_EQ(restored.enableWriteAheadLog(path), 2u);
+  EXPECT_TRUE(restored.hasVertex("A"));
+  EXPECT_TRUE(restored.hasVertex("B"));
+  EXPECT_FALSE(restored.hasVertex(big));
+}
+
+TEST_F(WriteAheadLogTest, DurabilityFailuresReachTheCommitter) {
+  // Every write to /dev/full fails with ENOSPC once it is flushed.
+  if (!std::filesystem::exists("/dev/full"))
+    GTEST_SKIP() << "needs /dev/full";
+  auto [log, status] = WriteAheadLog::open("/dev/full");
+  ASSERT_TRUE(status.isOK());
+  {
+    WalTransaction idle(log.get());
+    EXPECT_TRUE(idle.commit().isOK());
+  }
+  WalTransaction tx(log.get());
+  tx.record(WalFrameWriter<int, int>(WalRecordTag::ClearEdges).finish());
+  EXPECT_FALSE(tx.commit().isOK());
+  // The error is sticky, and a second commit() does nothing.
+  EXPECT_TRUE(tx.commit().isOK());
+  EXPECT_FALSE(log->status().isOK());
+}
+
+TEST_F(WriteAheadLogTest, SyncPolicies) {
+  WalOptions everyOps;
+  everyOps.policy = WalSyncPolicy::EveryNOps;
+  everyOps.syncEveryOps = 4;
+  auto [log, status] = WriteAheadLog::open(path, everyOps);
+  ASSERT_TRUE(status.isOK());
+  for (int i = 1; i <= 3; ++i)
+    log->commit(log->append(
+        WalFrameWriter<int, int>(WalRecordTag::ClearEdges).finish()));
+  EXPECT_EQ(log->durableCount(), 0u);
+  log->commit(log->append(
+      WalFrameWriter<int, int>(WalRecordTag::ClearEdges).finish()));
+  EXPECT_EQ(log->durableCount(), 4u);
+  log.reset();
+
+  WalOptions interval;
+  interval.policy = WalSyncPolicy::EveryInterval;
+  interval.syncInterval = std::chrono::milliseconds(1);
+  auto [timed, timedStatus] = WriteAheadLog::open(path, interval);
+  ASSERT_TRUE(timedStatus.isOK());
+  uint64_t lsn = timed->append(
+      WalFrameWriter<int, int>(WalRecordTag::ClearEdges).finish());
+  timed->commit(lsn);
+  for (int i = 0; i < 2000 && timed->durableCount() < lsn; ++i)
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  EXPECT_EQ(timed->durableCount(), lsn);
+}
+
+TEST_F(WriteAheadLogTest, ConcurrentWritersShareCommits) {
+  constexpr int THREADS = 4;
+  constexpr int PER_THREAD = 200;
+  {
+    CinderGraph<int, int> graph;
+    graph.enableWriteAheadLog(path);
+    std::vector<std::thread> writers;
+    for (int t = 0; t < THREADS; ++t) {
+      writers.emplace_back([&graph, t] {
+        for (int i = 0; i < PER_THREAD; ++i)
+          graph.addVertex(t * PER_THREAD + i);
+      });
+    }
+    for (auto &writer : writers)
+      writer.join();
+    EXPECT_TRUE(graph.syncWriteAheadLog());
+  }
+  CinderGraph<int, int> restored;
+  EXPECT_EQ(restored.enableWriteAheadLog(path),
+            static_cast<size_t>(THREADS * PER_THREAD));
+  EXPECT_EQ(restored.numVertices(), static_cast<size_t>(THREADS * PER_THREAD));
+}
@@ -0,0 +1,87 @@
+#include "DummyGraphBuilder.hpp"
+#include "Operations/WriteBatch.hpp"
+#include "StorageEngine/HybridCSR_COO.hpp"
+#include "gtest/gtest.h"
+
+using namespace CinderPeak;
+
+class WriteBatchTest : public ::testing::Test {
+protected:
+  DummyGraph builder;
+};
+
+TEST_F(WriteBatchTest, AppliesOperationsInOrder) {
+  auto graph = builder.CreatePrimitiveWeightedGraph();
+  WriteBatch<int, int> batch;
+  batch.addVertex(1).addVertex(2).addVertex(3);
+  batch.addEdge(1, 2, 5).addEdge(2, 3, 7).updateEdge(1, 2, 9);
+  batch.removeEdge(2, 3);
+
+  BatchResult result = graph.apply(batch);
+  EXPECT_TRUE(result.allApplied());
+  EXPECT_EQ(result.applied, std::vector<bool>(batch.size(), true));
+  EXPECT_EQ(graph.numVertices(), 3u);
+  EXPECT_EQ(graph.numEdges(), 1u);
+  EXPECT_EQ(graph.getEdge(1, 2).value_or(0), 9);
+  EXPECT_FALSE(graph.getEdge(2, 3).has_value());
+}
+
+TEST_F(WriteBatchTest, FailedOperationsAreSkippedAndReported) {
+  auto graph = builder.CreatePrimitiveWeightedGraph();
+  EXPECT_TRUE(graph.addVertex(1).second);
+
+  WriteBatch<int, int> batch;
+  batch.addVertex(1);        // duplicate
+  batch.addVertex(2);        // ok
+  batch.addEdge(1, 1, 3);    // self loop
+  batch.addEdge(1, 2, 3);    // ok, sees vertex 2 from this batch
+  batch.removeEdge(2, 1);    // missing edge
+  batch.updateEdge(1, 9, 4); // missing vertex
+
+  BatchResult result = graph.apply(batch);
+  EXPECT_EQ(result.applied, (std::vector<bool>{false, true, false, true,
+                                               false, false}));
+  EXPECT_EQ(result.failed, 4u);
+  EXPECT_EQ(result.firstError.code(), StatusCode::VERTEX_ALREADY_EXISTS);
+  EXPECT_EQ(graph.numVertices(), 2u);
+  EXPECT_EQ(graph.numEdges(), 1u);
+}
+
+TEST_F(WriteBatchTest, UndirectedBatchWritesEdgePairs) {
+  auto graph = builder.CreatePrimitiveWeightedGraph(GraphOpts::undirected);
+  WriteBatch<int, int> batch;
+  batch.addVertex(1).addVertex(2).addVertex(3);
+  batch.addEdge(1, 2, 4).addEdge(2, 3, 6);
+  batch.addEdge(2, 1, 4); // reverse of an edge added above
+  batch.updateEdge(3, 2, 8);
+
+  BatchResult result = graph.apply(batch);
+  EXPECT_EQ(result.failed, 1u);
+  EXPECT_FALSE(result.applied[5]);
+  EXPECT_EQ(graph.numEdges(), 4u);
+  EXPECT_EQ(graph.getEdge(2, 1).value_or(0), 4);
+  EXPECT_EQ(graph.getEdge(2, 3).value_or(0), 8);
+
+  WriteBatch<int, int> removal;
+  removal.removeEdge(2, 1);
+  EXPECT_TRUE(graph.apply(removal).allApplied());
+  EXPECT_FALSE(graph.getEdge(1, 2).has_value());
+  EXPECT_EQ(graph.numEdges(), 2u);
+}
+
+TEST(HybridWriteBatchTest, AppliesOnCooAndCsr) {
+  PeakStore::HybridCSR_COO<int, int> graph;
+  WriteBatch<int, int> batch;
+  batch.addVertex(1).addVertex(2).addVertex(3).addEdge(1, 2, 5);
+  EdgeInsertRules rules{true, true};
+  EXPECT_TRUE(graph.impl_applyBatch(batch, rules).allApplied());
+
+  graph.orchestrator_buildIfNeeded();
+  WriteBatch<int, int> next;
+  next.updateEdge(1, 2, 6).addEdge(2, 3, 1).removeVertex(3).addEdge(1, 2, 6);
+  BatchResult result = graph.impl_applyBatch(next, rules);
+  EXPECT_EQ(result.applied, (std::vector<bool>{true, true, true, false}));
+  EXPECT_EQ(result.firstError.code(), StatusCode::EDGE_ALREADY_EXISTS);
+  EXPECT_EQ(graph.impl_getEdge(1, 2).first, 6);
+  EXPECT_FALSE(graph.impl_hasVertex(3));
+}
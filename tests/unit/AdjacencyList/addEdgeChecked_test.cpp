@@ -0,0 +1,61 @@
+#include "AdjacencyListTestBase.hpp"
+#include "StorageEngine/HybridCSR_COO.hpp"
+#include <atomic>
+#include <vector>
+
+TEST_F(AdjacencyStorageShardTest, AddEdgeCheckedAppliesRules) {
+  EdgeInsertRules directed{true, true};
+  EXPECT_TRUE(intGraph.impl_addEdgeChecked(1, 2, 10, directed).isOK());
+  EXPECT_EQ(intGraph.impl_addEdgeChecked(1, 2, 10, directed).code(),
+            StatusCode::EDGE_ALREADY_EXISTS);
+  // Weighted graphs only treat an equal weight as a duplicate.
+  EXPECT_TRUE(intGraph.impl_addEdgeChecked(1, 2, 11, directed).isOK());
+  EXPECT_EQ(intGraph.impl_addEdgeChecked(1, 1, 1, directed).code(),
+            StatusCode::INVALID_ARGUMENT);
+  EXPECT_EQ(intGraph.impl_addEdgeChecked(1, 999, 1, directed).code(),
+            StatusCode::VERTEX_NOT_FOUND);
+
+  // Undirected: an existing reverse edge blocks the insert.
+  EdgeInsertRules undirected{false, false};
+  EXPECT_TRUE(intGraph.impl_addEdgeChecked(3, 4, 0, undirected).isOK());
+  EXPECT_EQ(intGraph.impl_addEdgeChecked(4, 3, 7, undirected).code(),
+            StatusCode::EDGE_ALREADY_EXISTS);
+}
+
+TEST_F(AdjacencyStorageShardTest, AddEdgeCheckedAdmitsOneOfConcurrentInserts) {
+  std::atomic<int> inserted{0};
+  std::vector<std::thread> threads;
+  for (int t = 0; t < 8; ++t) {
+    threads.emplace_back([&] {
+      for (int i = 0; i < 100; ++i) {
+        if (intGraph.impl_addEdgeChecked(101, 102, 1, {false, true}).isOK())
+          inserted.fetch_add(1);
+      }
+    });
+  }
+  for (auto &t : threads)
+    t.join();
+
+  EXPECT_EQ(inserted.load(), 1);
+  auto [neighbors, status] = intGraph.impl_getNeighbors(101);
+  EXPECT_TRUE(status.isOK());
+  EXPECT_EQ(neighbors.size(), 1u);
+}
+
+TEST(HybridAddEdgeCheckedTest, SeesPendingAndBuiltEdges) {
+  HybridCSR_COO<int, int> graph;
+  for (int v = 1; v <= 3; ++v)
+    (void)graph.impl_addVertex(v);
+  EdgeInsertRules rules{false, true};
+  EXPECT_TRUE(graph.impl_addEdgeChecked(1, 2, 5, rules).isOK());
+  EXPECT_EQ(graph.impl_addEdgeChecked(1, 2, 6, rules).code(),
+            StatusCode::EDGE_ALREADY_EXISTS);
+
+  graph.orchestrator_buildIfNeeded();
+  EXPECT_EQ(graph.impl_addEdgeChecked(1, 2, 6, rules).code(),
+            StatusCode::EDGE_ALREADY_EXISTS);
+  EXPECT_EQ(graph.impl_addEdgeChecked(2, 1, 6, {false, false}).code(),
+            StatusCode::EDGE_ALREADY_EXISTS);
+  EXPECT_TRUE(graph.impl_addEdgeChecked(2, 3, 6, rules).isOK());
+  EXPECT_TRUE(graph.impl_doesEdgeExist(2, 3));
+}
@@ -0,0 +1,79 @@
+#include "AdjacencyListTestBase.hpp"
+#include <algorithm>
+#include <string>
+
+TEST_F(AdjacencyStorageShardTest, RemovedIdsAreReused) {
+  auto idOf = [&](int v) {
+    return *intGraph.getVertexIndex().find(v);
+  };
+  VertexId removedId = idOf(3);
+  ASSERT_TRUE(intGraph.impl_removeVertex(3).isOK());
+  EXPECT_EQ(intGraph.freeIdCount(), 1u);
+
+  ASSERT_TRUE(intGraph.impl_addVertex(42).isOK());
+  EXPECT_EQ(idOf(42), removedId);
+  EXPECT_EQ(intGraph.freeIdCount(), 0u);
+
+  // Recycled id must not inherit the old vertex's edges.
+  auto [neighbors, status] = intGraph.impl_getNeighbors(42);
+  EXPECT_TRUE(status.isOK());
+  EXPECT_TRUE(neighbors.empty());
+}
+
+TEST_F(AdjacencyStorageShardTest, CompactIdsRenumbersDensely) {
+  (void)intGraph.impl_addEdge(1, 5, 15);
+  (void)intGraph.impl_addEdge(5, 103, 20);
+  (void)intGraph.impl_addEdge(103, 1, 25);
+  ASSERT_TRUE(intGraph.impl_removeVertex(2).isOK());
+  ASSERT_TRUE(intGraph.impl_removeVertex(4).isOK());
+  ASSERT_TRUE(intGraph.impl_removeVertex(101).isOK());
+
+  ASSERT_TRUE(intGraph.compactIds().isOK());
+  EXPECT_EQ(intGraph.freeIdCount(), 0u);
+
+  const auto &adj = intGraph.getInternalAdjacency();
+  ASSERT_EQ(adj.size(), 5u);
+  for (VertexId id = 1; id <= 5; ++id)
+    EXPECT_EQ(adj.count(id), 1u) << "missing id " << id;
+
+  auto [w1, s1] = intGraph.impl_getEdge(1, 5);
+  auto [w2, s2] = intGraph.impl_getEdge(5, 103);
+  auto [w3, s3] = intGraph.impl_getEdge(103, 1);
+  EXPECT_TRUE(s1.isOK() && s2.isOK() && s3.isOK());
+  EXPECT_EQ(w1, 15);
+  EXPECT_EQ(w2, 20);
+  EXPECT_EQ(w3, 25);
+
+  // The next vertex continues after the dense range.
+  ASSERT_TRUE(intGraph.impl_addVertex(7).isOK());
+  EXPECT_EQ(*intGraph.getVertexIndex().find(7), VertexId{6});
+}
+
+TEST_F(AdjacencyStorageShardTest, CompactIdsKeepsStringNames) {
+  (void)stringGraph.impl_addEdge("A", "C", 2.5f);
+  ASSERT_TRUE(stringGraph.impl_removeVertex("B").isOK());
+  ASSERT_TRUE(stringGraph.compactIds().isOK());
+
+  auto vertices = stringGraph.impl_getVertices();
+  std::sort(vertices.begin(), vertices.end());
+  EXPECT_EQ(vertices, (std::vector<std::string>{"A", "C"}));
+  auto [weight, status] = stringGraph.impl_getEdge("A", "C");
+  EXPECT_TRUE(status.isOK());
+  EXPECT_FLOAT_EQ(weight, 2.5f);
+}
+
+TEST_F(AdjacencyStorageShardTest, CompactIdsReleasesRemovedNames) {
+  for (int round = 0; round < 50; ++round) {
+    std::string name = "tmp" + std::to_string(round);
+    ASSERT_TRUE(stringGraph.impl_addVertex(name).isOK());
+    ASSERT_TRUE(stringGraph.impl_removeVertex(name).isOK());
+  }
+  size_t live = stringGraph.impl_getVertices().size();
+  EXPECT_EQ(stringGraph.getVertexIndex().interner().size(), live + 50);
+
+  ASSERT_TRUE(stringGraph.compactIds().isOK());
+  EXPECT_EQ(stringGraph.getVertexIndex().interner().size(), live);
+  EXPECT_FALSE(stringGraph.impl_hasVertex("tmp0"));
+  ASSERT_TRUE(stringGraph.impl_addVertex("tmp0").isOK());
+  EXPECT_TRUE(stringGraph.impl_hasVertex("tmp0"));
+}
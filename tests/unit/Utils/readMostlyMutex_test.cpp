@@ -0,0 +1,90 @@
+// Unit tests for ReadMostlyMutex — StorageEngine/ReadMostlyMutex.hpp
+
+#include "GraphRuntime.hpp"
+#include "StorageEngine/AdjacencyList.hpp"
+#include "StorageEngine/ReadMostlyMutex.hpp"
+#include <atomic>
+#include <gtest/gtest.h>
+#include <mutex>
+#include <shared_mutex>
+#include <thread>
+#include <vector>
+
+using namespace CinderPeak;
+using namespace CinderPeak::PeakStore;
+
+TEST(ReadMostlyMutexTest, ShardCountIsBoundedPowerOfTwo) {
+  EXPECT_EQ(ReadMostlyMutex(1).shardCount(), 1u);
+  EXPECT_EQ(ReadMostlyMutex(3).shardCount(), 4u);
+  EXPECT_EQ(ReadMostlyMutex(8).shardCount(), 8u);
+  EXPECT_EQ(ReadMostlyMutex(1000).shardCount(), 16u);
+}
+
+TEST(ReadMostlyMutexTest, WriterExcludesReadersOnEveryShard) {
+  ReadMostlyMutex mtx(4);
+  std::unique_lock<ReadMostlyMutex> writer(mtx);
+
+  std::vector<std::thread> readers;
+  std::atomic<int> acquired{0};
+  for (int i = 0; i < 4; ++i) {
+    readers.emplace_back([&] {
+      if (mtx.try_lock_shared()) {
+        acquired.fetch_add(1);
+        mtx.unlock_shared();
+      }
+    });
+  }
+  for (auto &t : readers)
+    t.join();
+  EXPECT_EQ(acquired.load(), 0);
+
+  writer.unlock();
+  std::shared_lock<ReadMostlyMutex> reader(mtx);
+  bool writerAcquired = true;
+  std::thread([&] {
+    writerAcquired = mtx.try_lock();
+    if (writerAcquired)
+      mtx.unlock();
+  }).join();
+  EXPECT_FALSE(writerAcquired);
+}
+
+TEST(ReadMostlyMutexTest, ConcurrentReadersAndWriterOnAdjacencyList) {
+  GraphRuntime runtime;
+  AdjacencyList<int, int> graph(runtime);
+  constexpr int N = 200;
+  for (int v = 0; v < N; ++v)
+    (void)graph.impl_addVertex(v);
+  for (int v = 1; v < N; ++v)
+    (void)graph.impl_addEdge(0, v, v);
+
+  std::atomic<bool> stop{false};
+  std::atomic<int> mismatches{0};
+  std::vector<std::thread> readers;
+  for (int r = 0; r < 4; ++r) {
+    readers.emplace_back([&] {
+      while (!stop.load()) {
+        for (int v = 1; v < N; ++v) {
+          auto [weight, status] = graph.impl_getEdge(0, v);
+          if (status.isOK() && weight != v)
+            mismatches.fetch_add(1);
+          if (!graph.impl_hasVertex(v))
+            mismatches.fetch_add(1);
+        }
+      }
+    });
+  }
+
+  for (int round = 0; round < 50; ++round) {
+    for (int v = 1; v < N; v += 7)
+      (void)graph.impl_removeEdge(0, v);
+    for (int v = 1; v < N; v += 7)
+      (void)graph.impl_addEdge(0, v, v);
+  }
+  stop.store(true);
+  for (auto &t : readers)
+    t.join();
+
+  EXPECT_EQ(mismatches.load(), 0);
+  EXPECT_TRUE(graph.impl_doesEdgeExist(0, N - 1));
+}
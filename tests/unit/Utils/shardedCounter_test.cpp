@@ -0,0 +1,60 @@
+// Unit tests for ShardedCounter — StorageEngine/ShardedCounter.hpp
+
+#include "StorageEngine/GraphStatistics.hpp"
+#include "StorageEngine/ShardedCounter.hpp"
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+
+using namespace CinderPeak::PeakStore;
+
+TEST(ShardedCounterTest, AddLoadAndStore) {
+  ShardedCounter counter(4);
+  EXPECT_EQ(counter.shardCount(), 4u);
+  EXPECT_EQ(ShardedCounter(1).shardCount(), 1u);
+  EXPECT_EQ(ShardedCounter(1000).shardCount(), 16u);
+
+  counter.add(5);
+  counter.add(-2);
+  EXPECT_EQ(counter.load(), 3u);
+  counter.add(-10);
+  EXPECT_EQ(counter.load(), 0u); // clamped, never wraps
+  counter.store(7);
+  EXPECT_EQ(counter.load(), 7u);
+}
+
+TEST(ShardedCounterTest, ConcurrentAddsAreNotLost) {
+  ShardedCounter counter(8);
+  constexpr int THREADS = 8;
+  constexpr int PER_THREAD = 100000;
+  std::vector<std::thread> threads;
+  for (int t = 0; t < THREADS; ++t) {
+    threads.emplace_back([&, t] {
+      for (int i = 0; i < PER_THREAD; ++i)
+        counter.add(t % 2 == 0 ? 2 : -1);
+    });
+  }
+  for (auto &t : threads)
+    t.join();
+  EXPECT_EQ(counter.load(), static_cast<size_t>(THREADS / 2 * PER_THREAD));
+}
+
+TEST(ShardedCounterTest, MetadataCountsAndDensity) {
+  GraphInternalMetadata metadata("graph", true, true, true, false);
+  for (int i = 0; i < 4; ++i)
+    metadata.updateVertexCount(UpdateOp::Add);
+  metadata.updateEdgeCount(UpdateOp::Add, 6);
+  metadata.applyCountDelta(0, 0, 0, 3);
+
+  GraphCounts counts = metadata.counts();
+  EXPECT_EQ(counts.vertices, 4u);
+  EXPECT_EQ(counts.edges, 3u);
+  EXPECT_FLOAT_EQ(counts.density(), 0.25f);
+  EXPECT_FLOAT_EQ(metadata.density(), 0.25f);
+
+  GraphInternalMetadata copy(metadata);
+  EXPECT_EQ(copy.numEdges(), 3u);
+  metadata.updateEdgeCount(UpdateOp::Clear);
+  EXPECT_EQ(metadata.numEdges(), 0u);
+  EXPECT_EQ(copy.numEdges(), 3u);
+}
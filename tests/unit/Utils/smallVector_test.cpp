@@ -0,0 +1,105 @@
+// Unit tests for SmallVector — StorageEngine/SmallVector.hpp
+
+#include "GraphRuntime.hpp"
+#include "StorageEngine/AdjacencyList.hpp"
+#include "StorageEngine/SmallVector.hpp"
+#include <gtest/gtest.h>
+#include <memory>
+#include <string>
+
+using namespace CinderPeak;
+using namespace CinderPeak::PeakStore;
+
+TEST(SmallVectorTest, StaysInlineUpToN) {
+  SmallVector<int, 4> v;
+  EXPECT_TRUE(v.empty());
+  EXPECT_TRUE(v.isInline());
+  for (int i = 0; i < 4; ++i)
+    v.push_back(i);
+  EXPECT_TRUE(v.isInline());
+  EXPECT_EQ(v.capacity(), 4u);
+
+  v.push_back(4);
+  EXPECT_FALSE(v.isInline());
+  ASSERT_EQ(v.size(), 5u);
+  for (int i = 0; i < 5; ++i)
+    EXPECT_EQ(v[static_cast<size_t>(i)], i);
+}
+
+TEST(SmallVectorTest, EraseAndShrinkBackInline) {
+  SmallVector<int, 2> v{1, 2, 3, 4};
+  v.erase(v.begin() + 1);
+  EXPECT_EQ(v, (SmallVector<int, 2>{1, 3, 4}));
+  v.erase(v.begin(), v.begin() + 2);
+  ASSERT_EQ(v.size(), 1u);
+  EXPECT_EQ(v.front(), 4);
+
+  v.shrink_to_fit();
+  EXPECT_TRUE(v.isInline());
+  EXPECT_EQ(v.front(), 4);
+}
+
+TEST(SmallVectorTest, CopyAndMoveNonTrivialElements) {
+  SmallVector<std::string, 2> inl{"a", "b"};
+  SmallVector<std::string, 2> heap{"a", "b", "c"};
+
+  SmallVector<std::string, 2> inlCopy = inl;
+  SmallVector<std::string, 2> inlMoved = std::move(inl);
+  EXPECT_EQ(inlCopy, inlMoved);
+  EXPECT_TRUE(inlMoved.isInline());
+
+  const std::string *heapData = heap.data();
+  SmallVector<std::string, 2> heapMoved = std::move(heap);
+  EXPECT_EQ(heapMoved.data(), heapData); // buffer stolen, not copied
+  EXPECT_TRUE(heap.empty());
+  EXPECT_TRUE(heap.isInline());
+
+  inlCopy = heapMoved;
+  EXPECT_EQ(inlCopy.size(), 3u);
+  EXPECT_EQ(inlCopy.back(), "c");
+}
+
+TEST(SmallVectorTest, EmplaceBackAliasingOwnElement) {
+  SmallVector<std::string, 1> v{"self"};
+  v.emplace_back(v[0]); // grows while copying from the old buffer
+  ASSERT_EQ(v.size(), 2u);
+  EXPECT_EQ(v[1], "self");
+}
+
+TEST(SmallVectorTest, ElementsAreDestroyed) {
+  auto tracker = std::make_shared<int>(0);
+  {
+    SmallVector<std::shared_ptr<int>, 2> v;
+    for (int i = 0; i < 5; ++i)
+      v.push_back(tracker);
+    EXPECT_EQ(tracker.use_count(), 6);
+    v.pop_back();
+    v.erase(v.begin());
+    EXPECT_EQ(tracker.use_count(), 4);
+  }
+  EXPECT_EQ(tracker.use_count(), 1);
+}
+
+TEST(SmallVectorTest, AdjacencyRowsSpillPastInlineCapacity) {
+  GraphRuntime runtime;
+  AdjacencyList<int, int, 2> graph(runtime);
+  for (int v = 1; v <= 4; ++v)
+    (void)graph.impl_addVertex(v);
+  (void)graph.impl_addEdge(1, 2, 10);
+  (void)graph.impl_addEdge(2, 3, 20);
+  (void)graph.impl_addEdge(2, 4, 30);
+  (void)graph.impl_addEdge(2, 1, 40);
+
+  const auto &adj = graph.getInternalAdjacency();
+  size_t inlineRows = 0;
+  for (const auto &[id, row] : adj)
+    inlineRows += row.isInline() ? 1 : 0;
+  EXPECT_EQ(inlineRows, 3u); // only vertex 2 has more than 2 neighbors
+
+  auto [neighbors, status] = graph.impl_getNeighbors(2);
+  ASSERT_TRUE(status.isOK());
+  EXPECT_EQ(neighbors.size(), 3u);
+  EXPECT_TRUE(graph.impl_removeEdge(2, 4).second.isOK());
+  EXPECT_FALSE(graph.impl_doesEdgeExist(2, 4));
+  EXPECT_TRUE(graph.impl_doesEdgeExist(2, 1));
+}
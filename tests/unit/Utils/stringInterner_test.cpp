@@ -0,0 +1,137 @@
+// Unit tests for StringInterner and VertexIndex —
+// StorageEngine/StringInterner.hpp, StorageEngine/VertexIndex.hpp
+
+#include "GraphRuntime.hpp"
+#include "StorageEngine/AdjacencyList.hpp"
+#include "StorageEngine/HybridCSR_COO.hpp"
+#include "StorageEngine/StringInterner.hpp"
+#include "StorageEngine/VertexIndex.hpp"
+#include <algorithm>
+#include <gtest/gtest.h>
+#include <string>
+
+using namespace CinderPeak;
+using namespace CinderPeak::PeakStore;
+
+TEST(StringInternerTest, InternReturnsSameIdForEqualStrings) {
+  StringInterner interner;
+  InternId a = interner.intern("alpha");
+  InternId b = interner.intern(std::string("alpha"));
+  InternId c = interner.intern("beta");
+
+  EXPECT_EQ(a, b);
+  EXPECT_NE(a, c);
+  EXPECT_EQ(interner.size(), 2u);
+  EXPECT_EQ(interner.view(a), "alpha");
+  EXPECT_EQ(interner.view(c), "beta");
+}
+
+TEST(StringInternerTest, ViewsStayValidAcrossBlocks) {
+  StringInterner interner;
+  std::vector<InternId> ids;
+  for (int i = 0; i < 20000; ++i) {
+    ids.push_back(
+        interner.intern("https://example.com/page/" + std::to_string(i)));
+  }
+  for (int i = 0; i < 20000; ++i) {
+    EXPECT_EQ(interner.view(ids[static_cast<size_t>(i)]),
+              "https://example.com/page/" + std::to_string(i));
+  }
+  EXPECT_GT(interner.bytesReserved(), 0u);
+}
+
+TEST(StringInternerTest, LargeAndEmptyStrings) {
+  StringInterner interner;
+  std::string big(100000, 'x');
+  InternId small = interner.intern("s");
+  InternId large = interner.intern(big);
+  InternId empty = interner.intern("");
+
+  EXPECT_EQ(interner.view(large), big);
+  EXPECT_EQ(interner.view(small), "s");
+  EXPECT_EQ(interner.view(empty), "");
+  EXPECT_EQ(interner.find(""), empty);
+  EXPECT_FALSE(interner.find("missing").has_value());
+}
+
+TEST(StringInternerTest, ClearReleasesEverything) {
+  StringInterner interner;
+  (void)interner.intern("alpha");
+  interner.clear();
+  EXPECT_EQ(interner.size(), 0u);
+  EXPECT_EQ(interner.bytesReserved(), 0u);
+  EXPECT_FALSE(interner.find("alpha").has_value());
+}
+
+TEST(VertexIndexTest, StringKeysReuseInternedName) {
+  VertexIndex<std::string, VertexId> index;
+  auto key = index.insert("A", 1);
+  EXPECT_EQ(index.find("A"), VertexId{1});
+  EXPECT_EQ(index.size(), 1u);
+
+  index.erase(key);
+  EXPECT_FALSE(index.contains("A"));
+  EXPECT_EQ(index.size(), 0u);
+
+  auto again = index.insert("A", 7);
+  EXPECT_EQ(again, key);
+  EXPECT_EQ(index.find("A"), VertexId{7});
+  EXPECT_EQ(index.interner().size(), 1u);
+}
+
+TEST(VertexIndexTest, ResetIdsKeepsKeysReadable) {
+  VertexIndex<std::string, size_t> index;
+  auto a = index.insert("A", 0);
+  auto b = index.insert("B", 1);
+  index.resetIds();
+  EXPECT_FALSE(index.contains("A"));
+  index.assign(b, 0);
+  EXPECT_EQ(index.find("B"), size_t{0});
+  EXPECT_EQ(index.value(a), "A");
+}
+
+TEST(VertexIndexTest, AdjacencyListStringRoundTrip) {
+  GraphRuntime runtime;
+  AdjacencyList<std::string, int> graph(runtime);
+  (void)graph.impl_addVertex("a");
+  (void)graph.impl_addVertex("b");
+  (void)graph.impl_addVertex("c");
+  (void)graph.impl_addEdge("a", "b", 1);
+  (void)graph.impl_addEdge("a", "c", 2);
+  (void)graph.impl_removeVertex("b");
+  (void)graph.impl_addVertex("b");
+  (void)graph.impl_addEdge("c", "b", 3);
+
+  auto [neighbors, status] = graph.impl_getNeighbors("a");
+  ASSERT_TRUE(status.isOK());
+  ASSERT_EQ(neighbors.size(), 1u);
+  EXPECT_EQ(neighbors[0].first, "c");
+
+  auto vertices = graph.impl_getVertices();
+  std::sort(vertices.begin(), vertices.end());
+  EXPECT_EQ(vertices, (std::vector<std::string>{"a", "b", "c"}));
+  EXPECT_EQ(graph.getVertexIndex().interner().size(), 3u);
+
+  auto edges = graph.impl_getEdgeList();
+  EXPECT_EQ(edges.size(), 2u);
+}
+
+TEST(VertexIndexTest, HybridStringCompactionKeepsNames) {
+  HybridCSR_COO<std::string, int> graph;
+  (void)graph.impl_addVertex("a");
+  (void)graph.impl_addVertex("b");
+  (void)graph.impl_addVertex("c");
+  (void)graph.impl_addEdge("a", "c", 5);
+  (void)graph.impl_removeVertex("b");
+  graph.orchestrator_buildIfNeeded();
+
+  EXPECT_FALSE(graph.impl_hasVertex("b"));
+  auto [weight, status] = graph.impl_getEdge("a", "c");
+  EXPECT_TRUE(status.isOK());
+  EXPECT_EQ(weight, 5);
+
+  auto edges = graph.impl_getEdgeList();
+  ASSERT_EQ(edges.size(), 1u);
+  EXPECT_EQ(std::get<0>(edges[0]), "a");
+  EXPECT_EQ(std::get<1>(edges[0]), "c");
+}